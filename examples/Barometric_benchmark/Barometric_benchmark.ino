@@ -0,0 +1,119 @@
+///
+/// @file		Barometric_benchmark.ino
+/// @brief		Main sketch
+///
+/// @details	Speed and error of Barometric_Formula against the pow()-based formula
+/// @n          Altitudes are swept from -500 to 9000 m.
+/// @n @a		Developed with [embedXcode+](http://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		http://embeddedcomputing.weebly.com
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2016-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+/// @n
+///
+
+
+// Core library for code-sense - IDE-based
+#if defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#else // error
+#error Platform not supported
+#endif // end IDE
+
+// Include application, user and local libraries
+#include "Sensor_Barometric.h"
+
+// Define variables and constants
+#define total_steps 1024
+const float seaLevelPressure = 1013.25;
+
+Barometric_Formula myBarometric(seaLevelPressure);
+volatile float sink;
+volatile int32_t sinkFixed;
+
+float pressureAt(uint16_t step)
+{
+    float altitude = -500.0 + 9500.0 * (float)step / (float)total_steps;
+    return seaLevelPressure * pow(1.0 - altitude / BAROMETRIC_ALTITUDE, 1.0 / BAROMETRIC_EXPONENT);
+}
+
+float altitudePow(float pressure)
+{
+    return BAROMETRIC_ALTITUDE * (1.0 - pow(pressure / seaLevelPressure, BAROMETRIC_EXPONENT));
+}
+
+// Add setup code
+void setup()
+{
+    Serial.begin(9600);
+    Serial.println("Barometric formula benchmark");
+}
+
+// Add loop code
+void loop()
+{
+    static float pressures[total_steps];
+    uint32_t chrono;
+    float maximum = 0.0;
+    float maximumFixed = 0.0;
+
+    for (uint16_t step = 0; step < total_steps; step++)
+    {
+        pressures[step] = pressureAt(step);
+    }
+
+    // Speed
+    chrono = micros();
+    for (uint16_t step = 0; step < total_steps; step++)
+    {
+        sink = altitudePow(pressures[step]);
+    }
+    chrono = micros() - chrono;
+    Serial.print("pow()           ");
+    Serial.print((float)chrono / total_steps);
+    Serial.println(" us/call");
+
+    chrono = micros();
+    for (uint16_t step = 0; step < total_steps; step++)
+    {
+        sink = myBarometric.altitude(pressures[step]);
+    }
+    chrono = micros() - chrono;
+    Serial.print("altitude()      ");
+    Serial.print((float)chrono / total_steps);
+    Serial.println(" us/call");
+
+    chrono = micros();
+    for (uint16_t step = 0; step < total_steps; step++)
+    {
+        sinkFixed = myBarometric.altitudeFixed((uint32_t)(pressures[step] * 25600.0));
+    }
+    chrono = micros() - chrono;
+    Serial.print("altitudeFixed() ");
+    Serial.print((float)chrono / total_steps);
+    Serial.println(" us/call");
+
+    // Error
+    for (uint16_t step = 0; step < total_steps; step++)
+    {
+        float reference = altitudePow(pressures[step]);
+        float error = fabs(myBarometric.altitude(pressures[step]) - reference);
+        float errorFixed = fabs((float)myBarometric.altitudeFixed((uint32_t)(pressures[step] * 25600.0)) / 1000.0 - reference);
+        maximum = (error > maximum) ? error : maximum;
+        maximumFixed = (errorFixed > maximumFixed) ? errorFixed : maximumFixed;
+    }
+    Serial.print("maximum error   ");
+    Serial.print(maximum);
+    Serial.print(" m, fixed ");
+    Serial.print(maximumFixed);
+    Serial.println(" m");
+
+    Serial.println();
+    delay(10000);
+}
@@ -0,0 +1,93 @@
+///
+/// @file		Board_demo.ino
+/// @brief		Main sketch
+///
+/// @details	Board detection by I²C probing, without USE_* flags
+/// @n          The profile is kept in RAM not initialised at reset, so a warm boot skips the probe.
+/// @n @a		Developed with [embedXcode+](http://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		http://embeddedcomputing.weebly.com
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2016-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+/// @n
+///
+
+
+// Core library for code-sense - IDE-based
+#if defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#else // error
+#error Platform not supported
+#endif // end IDE
+
+// Include application, user and local libraries
+#include "Wire.h"
+#include "Sensor_Units.h"
+#include "Sensor_Board.h"
+#include "Sensor_OPT3001.h"
+
+// Define variables and constants
+Sensor_Board myBoard;
+board_profile_s cachedProfile __attribute__((section(".noinit")));
+
+Sensor_OPT3001 * myOPT3001 = NULL;
+
+char record[64];
+Units_Line line(record, sizeof(record));
+
+// Add setup code
+void setup()
+{
+    Serial.begin(9600);
+    Wire.begin();
+
+    if (myBoard.restore(&cachedProfile))
+    {
+        Serial.println("Profile restored");
+    }
+    else
+    {
+        myBoard.probe();
+        cachedProfile = *myBoard.profile();
+    }
+
+    Serial.print("Board ");
+    Serial.println(myBoard.board(), DEC);
+    for (uint8_t index = 0; index < myBoard.profile()->count; index++)
+    {
+        Serial.print("Device ");
+        Serial.print(myBoard.profile()->sensors[index].device, DEC);
+        Serial.print(" at 0x");
+        Serial.println(myBoard.profile()->sensors[index].address, HEX);
+    }
+
+    // All boards have an OPT3001, at different addresses
+    uint8_t address = myBoard.address(SENSOR_DEVICE_OPT3001);
+    if (address > 0)
+    {
+        static Sensor_OPT3001 sensor(address);
+        myOPT3001 = &sensor;
+        myOPT3001->begin();
+    }
+}
+
+// Add loop code
+void loop()
+{
+    if (myOPT3001 != NULL)
+    {
+        myOPT3001->get();
+
+        line.clear();
+        line.add("light", myOPT3001->light(), LUX);
+        line.end();
+        Serial.write((const uint8_t *)line.c_str(), line.length());
+    }
+    delay(1000);
+}
@@ -0,0 +1,96 @@
+///
+/// @file		History_demo.ino
+/// @brief		Main sketch
+///
+/// @details	Light history with the timestamped ring buffer
+/// @n          OPT3001 every 100 ms into a 128-sample history, as scaled integers.
+/// @n          Minimum, maximum and average over the last 10 seconds, every second.
+/// @n @a		Developed with [embedXcode+](http://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		http://embeddedcomputing.weebly.com
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2016-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+/// @n
+///
+
+
+// Core library for code-sense - IDE-based
+#if defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#else // error
+#error Platform not supported
+#endif // end IDE
+
+// Include application, user and local libraries
+#include "Wire.h"
+#include "Sensor_Units.h"
+#include "Sensor_Interface.h"
+#include "Sensor_History.h"
+
+// Define variables and constants
+Sensor_OPT3001 myOPT3001;
+Sensor_Adapter<Sensor_OPT3001> myOPT3001Adapter(myOPT3001);
+
+// 128 x 8 bytes, raw() in 0.01 lux
+Sensor_History<128, int32_t> myLightHistory;
+
+uint32_t chrono = 0;
+
+char record[96];
+Units_Line line(record, sizeof(record));
+
+// Add setup code
+void setup()
+{
+    Serial.begin(9600);
+
+    Wire.begin();
+    myOPT3001.begin(OPT3001_100_MS_CONTINUOUS);
+}
+
+// Add loop code
+void loop()
+{
+    uint32_t now = millis();
+    if (myOPT3001Adapter.acquire() == SENSOR_FRESH)
+    {
+        myLightHistory.push(myOPT3001Adapter.raw(0), now);
+    }
+
+    if (now - chrono >= 1000)
+    {
+        chrono = now;
+
+        history_sample_s<int32_t> sample;
+        int32_t minimum = INT32_MAX;
+        int32_t maximum = INT32_MIN;
+        int32_t total = 0;
+        uint16_t count = 0;
+        for (uint16_t index = myLightHistory.first(now - 10000); myLightHistory.peek(index, sample); index++)
+        {
+            minimum = min(minimum, sample.value);
+            maximum = max(maximum, sample.value);
+            total += sample.value;
+            count++;
+        }
+
+        if (count > 0)
+        {
+            const sensor_channel_s * channel = myOPT3001Adapter.channel(0);
+            line.clear();
+            line.add("minimum", minimum * channel->resolution + channel->offset, *channel->unit);
+            line.add("maximum", maximum * channel->resolution + channel->offset, *channel->unit);
+            line.add("average", (float)total / count * channel->resolution + channel->offset, *channel->unit);
+            line.end();
+            Serial.write((const uint8_t *)line.c_str(), line.length());
+        }
+    }
+
+    delay(100);
+}
@@ -0,0 +1,83 @@
+///
+/// @file		Scheduler_demo.ino
+/// @brief		Main sketch
+///
+/// @details	Multi-rate acquisition with the deadline scheduler
+/// @n          BME280 every second, HDC2080 every 10 seconds, OPT3001 every 100 ms.
+/// @n          Conversions are triggered ahead of each deadline and the MCU sleeps in between.
+/// @n @a		Developed with [embedXcode+](http://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		http://embeddedcomputing.weebly.com
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2016-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+/// @n
+///
+
+
+// Core library for code-sense - IDE-based
+#if defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#else // error
+#error Platform not supported
+#endif // end IDE
+
+// Include application, user and local libraries
+#include "Wire.h"
+#include "Sensor_Units.h"
+#include "Sensor_Scheduler.h"
+
+// Define variables and constants
+Sensor_BME280 myBME280;
+Sensor_HDC2080 myHDC2080;
+Sensor_OPT3001 myOPT3001;
+
+Sensor_Adapter<Sensor_BME280> myBME280Adapter(myBME280);
+Sensor_Adapter<Sensor_HDC2080> myHDC2080Adapter(myHDC2080);
+Sensor_Adapter<Sensor_OPT3001> myOPT3001Adapter(myOPT3001);
+
+Sensor_Scheduler myScheduler;
+
+char record[96];
+Units_Line line(record, sizeof(record));
+
+// Add setup code
+void setup()
+{
+    Serial.begin(9600);
+
+    Wire.begin();
+    myBME280.begin();
+    myHDC2080.begin();
+    myOPT3001.begin(OPT3001_100_MS_CONTINUOUS);
+
+    myScheduler.add(&myBME280Adapter, 1000);
+    myScheduler.add(&myHDC2080Adapter, 10000);
+    myScheduler.add(&myOPT3001Adapter, 100);
+    myScheduler.begin();
+}
+
+// Add loop code
+void loop()
+{
+    uint8_t task = myScheduler.run();
+    if ((task == SCHEDULER_NONE) or (myScheduler.result(task) != SENSOR_FRESH))
+    {
+        return;
+    }
+
+    Sensor_Interface * sensor = myScheduler.sensor(task);
+    line.clear();
+    for (uint8_t index = 0; index < sensor->channels(); index++)
+    {
+        const sensor_channel_s * channel = sensor->channel(index);
+        line.add(channel->name, sensor->value(index), *channel->unit);
+    }
+    line.end();
+    Serial.write((const uint8_t *)line.c_str(), line.length());
+}
@@ -0,0 +1,118 @@
+///
+/// @file		Snapshot_demo.ino
+/// @brief		Main sketch
+///
+/// @details	Coherent snapshot of all the channels, taken from an interrupt
+/// @n          The scheduler acquires the sensors at their own periods and publishes a snapshot after each acquisition.
+/// @n          Pressing PUSH1 copies the last snapshot from the interrupt service routine, without blocking the acquisition.
+/// @n @a		Developed with [embedXcode+](http://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		http://embeddedcomputing.weebly.com
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2016-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+/// @n
+///
+
+
+// Core library for code-sense - IDE-based
+#if defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#else // error
+#error Platform not supported
+#endif // end IDE
+
+// Include application, user and local libraries
+#include "Wire.h"
+#include "Sensor_Units.h"
+#include "Sensor_Scheduler.h"
+#include "Sensor_Snapshot.h"
+
+// Define variables and constants
+Sensor_BME280 myBME280;
+Sensor_OPT3001 myOPT3001;
+
+Sensor_Adapter<Sensor_BME280> myBME280Adapter(myBME280);
+Sensor_Adapter<Sensor_OPT3001> myOPT3001Adapter(myOPT3001);
+
+Sensor_Scheduler myScheduler;
+Sensor_Snapshot mySnapshot;
+
+// First channel of each task in the snapshot
+uint8_t first[SCHEDULER_TASKS];
+const sensor_channel_s * channels[SNAPSHOT_CHANNELS];
+
+sensor_snapshot_s copy;
+volatile bool flagCopy = false;
+
+char record[96];
+Units_Line line(record, sizeof(record));
+
+// Reader side, in the interrupt service routine
+void buttonISR()
+{
+    if (not flagCopy)
+    {
+        flagCopy = mySnapshot.read(copy);
+    }
+}
+
+// Add setup code
+void setup()
+{
+    Serial.begin(9600);
+
+    Wire.begin();
+    myBME280.begin();
+    myOPT3001.begin(OPT3001_100_MS_CONTINUOUS);
+
+    Sensor_Interface * sensors[] = { &myBME280Adapter, &myOPT3001Adapter };
+    uint32_t periods[] = { 1000, 100 };
+    uint8_t index = 0;
+    for (uint8_t sensor = 0; sensor < 2; sensor++)
+    {
+        uint8_t task = myScheduler.add(sensors[sensor], periods[sensor]);
+        first[task] = index;
+        for (uint8_t channel = 0; channel < sensors[sensor]->channels(); channel++)
+        {
+            channels[index] = sensors[sensor]->channel(channel);
+            index++;
+        }
+    }
+    myScheduler.begin();
+
+    pinMode(PUSH1, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(PUSH1), buttonISR, FALLING);
+}
+
+// Add loop code
+void loop()
+{
+    // Writer side
+    uint8_t task = myScheduler.run();
+    if (task != SCHEDULER_NONE)
+    {
+        mySnapshot.update(first[task], myScheduler.sensor(task), myScheduler.result(task), millis());
+        mySnapshot.publish();
+    }
+
+    if (flagCopy)
+    {
+        Serial.print(copy.timestamp);
+        Serial.print(" ms ");
+
+        line.clear();
+        for (uint8_t index = 0; index < copy.count; index++)
+        {
+            line.add(channels[index]->name, copy.channels[index].value, *channels[index]->unit);
+        }
+        line.end();
+        Serial.write((const uint8_t *)line.c_str(), line.length());
+        flagCopy = false;
+    }
+}
@@ -0,0 +1,102 @@
+///
+/// @file		Units_benchmark.ino
+/// @brief		Main sketch
+///
+/// @details	Throughput of per-value versus batch units conversion
+/// @n          1M samples are converted from °K to °C, by blocks of buffer_size values.
+/// @n @a		Developed with [embedXcode+](http://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		http://embeddedcomputing.weebly.com
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2016-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+/// @n
+///
+
+
+// Core library for code-sense - IDE-based
+#if defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#else // error
+#error Platform not supported
+#endif // end IDE
+
+// Include application, user and local libraries
+#include "Sensor_Units.h"
+
+// Define variables and constants
+const uint32_t total_samples = 1048576;
+#define buffer_size 256
+
+float bufferFloat[buffer_size];
+int32_t bufferFixed[buffer_size];
+
+void fill()
+{
+    for (uint16_t index = 0; index < buffer_size; index++)
+    {
+        bufferFloat[index] = 273.15 + (float)index / 8.0;
+        bufferFixed[index] = (int32_t)(bufferFloat[index] * 256.0); // 8 fractional bits
+    }
+}
+
+void report(const char * label, uint32_t chrono)
+{
+    Serial.print(label);
+    Serial.print(chrono);
+    Serial.print(" us, ");
+    Serial.print((float)total_samples / (float)chrono);
+    Serial.println(" Msamples/s");
+}
+
+// Add setup code
+void setup()
+{
+    Serial.begin(9600);
+    Serial.println("Units conversion benchmark");
+}
+
+// Add loop code
+void loop()
+{
+    uint32_t chrono;
+    unit_transform_s k2c = transformation(KELVIN, CELSIUS);
+
+    // Per-value conversion()
+    fill();
+    chrono = micros();
+    for (uint32_t block = 0; block < total_samples / buffer_size; block++)
+    {
+        for (uint16_t index = 0; index < buffer_size; index++)
+        {
+            bufferFloat[index] = conversion(bufferFloat[index], KELVIN, CELSIUS);
+        }
+    }
+    report("conversion(value)     ", micros() - chrono);
+
+    // Batch conversion, float
+    fill();
+    chrono = micros();
+    for (uint32_t block = 0; block < total_samples / buffer_size; block++)
+    {
+        conversion(bufferFloat, bufferFloat, buffer_size, k2c);
+    }
+    report("conversion(float[])   ", micros() - chrono);
+
+    // Batch conversion, fixed-point
+    fill();
+    chrono = micros();
+    for (uint32_t block = 0; block < total_samples / buffer_size; block++)
+    {
+        conversion(bufferFixed, bufferFixed, buffer_size, k2c, 8);
+    }
+    report("conversion(int32_t[]) ", micros() - chrono);
+
+    Serial.println();
+    delay(10000);
+}
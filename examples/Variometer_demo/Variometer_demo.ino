@@ -0,0 +1,74 @@
+///
+/// @file		Variometer_demo.ino
+/// @brief		Main sketch
+///
+/// @details	Altitude and vertical speed from the BMP280 of the CC1350 SensorTag
+/// @n          The BMP280 runs in normal mode, samples are read as fast as possible.
+/// @n @a		Developed with [embedXcode+](http://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		http://embeddedcomputing.weebly.com
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2016-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+/// @n
+///
+
+
+// Core library for code-sense - IDE-based
+#if defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#else // error
+#error Platform not supported
+#endif // end IDE
+
+// Include application, user and local libraries
+#include "Wire.h"
+#include "Sensor_Units.h"
+#include "Sensor_BMP280.h"
+#include "Sensor_Variometer.h"
+
+// Define variables and constants
+Sensor_BMP280 myBMP280;
+Barometric_Variometer myVariometer;
+
+char record[64];
+Units_Line line(record, sizeof(record));
+
+const uint32_t report_ms = 1000;
+uint32_t chrono = 0;
+
+// Add setup code
+void setup()
+{
+    Serial.begin(9600);
+
+    Wire.begin();
+    myBMP280.begin();
+    myVariometer.setSeaLevel(1013.25);
+}
+
+// Add loop code
+void loop()
+{
+    if (myBMP280.get() == BMP280_SUCCESS)
+    {
+        myVariometer.update(myBMP280.pressure(), micros());
+    }
+
+    if (millis() - chrono > report_ms)
+    {
+        chrono = millis();
+
+        line.clear();
+        line.add("altitude", myVariometer.altitude(), METRE);
+        line.add("speed", myVariometer.verticalSpeed(), METRE);
+        line.add("/s");
+        line.end();
+        Serial.write((const uint8_t *)line.c_str(), line.length());
+    }
+}
@@ -67,6 +67,7 @@
 // Include application, user and local libraries
 #include "Wire.h"
 #include "Sensor_Units.h"
+#include "Sensor_Startup.h"
 
 
 // Define variables and constants
@@ -101,68 +102,88 @@ void setup()
 //    Wire.setModule(1);
     Wire.begin();
 
+    // Parallel initialisation: all resets, one wait, all configurations, one wait
+    Sensor_Startup myStartup;
+
 #if (USE_TMP007 == 1)
-    myTMP007.begin(TMP007_FOUR_SAMPLES);
-    myTMP007.get();
+    myStartup.after(myTMP007.beginReset(TMP007_FOUR_SAMPLES));
+#endif
+
+#if (USE_BME280 == 1)
+    myStartup.after(myBME280.beginReset());
 #endif
 
 #if (USE_OPT3001 == 1)
     myOPT3001.begin();
+#endif
+
+    myStartup.wait();
+
+#if (USE_TMP007 == 1)
+    myStartup.after(myTMP007.beginConfigure());
+#endif
+
+#if (USE_BME280 == 1)
+    myStartup.after(myBME280.beginConfigure());
+#endif
+
+#if (USE_OPT3001 == 1)
+    myStartup.after(myOPT3001.conversionTime());
+#endif
+
+    myStartup.wait();
+
+#if (USE_TMP007 == 1)
+    myTMP007.get(true);
+#endif
+
+#if (USE_OPT3001 == 1)
     myOPT3001.get();
 #endif
 
 #if (USE_BME280 == 1)
-    Serial.println("myBME280.begin");
-    myBME280.begin();
-    Serial.println("myBME280.get");
-    myBME280.get();
+    // Conversion started by beginConfigure(), already waited for
+    myBME280.readMeasurement();
 #endif
+
+    Serial.print("Initialisation ms ");
+    Serial.println(myStartup.elapsed(), DEC);
 }
 
+// Record for a single Serial.write(), no String
+char record[160];
+Units_Line line(record, sizeof(record));
+
 // Add loop code
 void loop()
 {
+    line.clear();
+
 #if (USE_TMP007 == 1)
     myTMP007.get();
     TMP007_internal = conversion(myTMP007.internal(), KELVIN, CELSIUS);
     TMP007_external = conversion(myTMP007.external(), KELVIN, CELSIUS);
-    Serial.print("TMP007_internal ");
-    Serial.print(TMP007_internal);
-    Serial.println(CELSIUS.symbol);
-
-    Serial.print("TMP007_external ");
-    Serial.print(TMP007_external);
-    Serial.println(CELSIUS.symbol);
+    line.add("TMP007_internal", TMP007_internal, CELSIUS);
+    line.add("TMP007_external", TMP007_external, CELSIUS);
 #endif
 
 #if (USE_OPT3001 == 1)
     myOPT3001.get();
     OPT3001_light = myOPT3001.light();
-    Serial.print("OPT3001_light             ");
-    Serial.print(OPT3001_light);
-    Serial.println(LUX.symbol);
+    line.add("OPT3001_light", OPT3001_light, LUX);
 #endif
 
 #if (USE_BME280 == 1)
-    Serial.println("myBME280.get");
     myBME280.get();
     BME280_pressure = myBME280.pressure();
     BME280_temperature = conversion(myBME280.temperature(), KELVIN, CELSIUS);
     BME280_humidity = myBME280.humidity();
-
-    Serial.print("BME280_pressure           ");
-    Serial.print(BME280_pressure);
-    Serial.println(HECTOPASCAL.symbol);
-
-    Serial.print("BME280_temperature        ");
-    Serial.print(BME280_temperature);
-    Serial.println(CELSIUS.symbol);
-
-    Serial.print("BME280_humidity           ");
-    Serial.print(BME280_humidity);
-    Serial.println("%");
+    line.add("BME280_pressure", BME280_pressure, HECTOPASCAL);
+    line.add("BME280_temperature", BME280_temperature, CELSIUS);
+    line.add("BME280_humidity", BME280_humidity, PERCENT);
 #endif
 
-    Serial.println();
+    line.end();
+    Serial.write((const uint8_t *)line.c_str(), line.length());
     delay(period_ms);
 }
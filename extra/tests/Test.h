@@ -0,0 +1,36 @@
+//
+// Test.h
+// Minimal checks for the host tests
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+
+#ifndef Test_h
+#define Test_h
+
+#include <stdio.h>
+
+static int testFailures = 0;
+
+#define TEST_CHECK(condition) \
+    do { if (not (condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); testFailures++; } } while (0)
+
+#define TEST_NEAR(value, expected, tolerance) \
+    do { double _value = (value); double _expected = (expected); \
+        if (not ((_value - _expected <= (tolerance)) and (_expected - _value <= (tolerance)))) \
+        { printf("%s:%d: %s = %g, expected %g +/- %g\n", __FILE__, __LINE__, #value, _value, _expected, (double)(tolerance)); testFailures++; } } while (0)
+
+static int testResult(const char * name)
+{
+    printf("%s: %s\n", name, (testFailures == 0) ? "passed" : "FAILED");
+    return (testFailures == 0) ? 0 : 1;
+}
+
+#endif
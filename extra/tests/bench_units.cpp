@@ -0,0 +1,87 @@
+//
+// bench_units.cpp
+// Throughput of per-value versus batch units conversion, on the host
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// 1M samples are converted from °K to °C. On x86 hosts, the batch float
+// conversion uses the SSE path, checked against the per-value conversion.
+//
+
+#include <chrono>
+#include <vector>
+#include "Test.h"
+#include "Sensor_Units.h"
+
+#define TOTAL_SAMPLES 1048576
+#define ROUNDS 16
+
+typedef std::chrono::steady_clock benchClock;
+
+static void report(const char * label, benchClock::time_point start)
+{
+    double seconds = std::chrono::duration<double>(benchClock::now() - start).count();
+    printf("%s %8.3f ms, %8.1f Msamples/s\n", label, seconds * 1000.0 / ROUNDS, (double)TOTAL_SAMPLES * ROUNDS / seconds / 1e6);
+}
+
+int main()
+{
+    std::vector<float> input(TOTAL_SAMPLES);
+    std::vector<float> reference(TOTAL_SAMPLES);
+    std::vector<float> output(TOTAL_SAMPLES);
+    std::vector<int32_t> inputFixed(TOTAL_SAMPLES);
+    std::vector<int32_t> outputFixed(TOTAL_SAMPLES);
+    unit_transform_s k2c = transformation(KELVIN, CELSIUS);
+
+    for (size_t index = 0; index < TOTAL_SAMPLES; index++)
+    {
+        input[index] = 233.15 + (float)(index % 16384) / 128.0;
+        inputFixed[index] = (int32_t)(input[index] * 256.0); // 8 fractional bits
+    }
+
+#if defined(__SSE__)
+    printf("batch float conversion: SSE\n");
+#else
+    printf("batch float conversion: scalar\n");
+#endif
+
+    benchClock::time_point start = benchClock::now();
+    for (uint8_t round = 0; round < ROUNDS; round++)
+    {
+        for (size_t index = 0; index < TOTAL_SAMPLES; index++)
+        {
+            reference[index] = conversion(input[index], KELVIN, CELSIUS);
+        }
+    }
+    report("conversion(value)    ", start);
+
+    start = benchClock::now();
+    for (uint8_t round = 0; round < ROUNDS; round++)
+    {
+        conversion(&input[0], &output[0], TOTAL_SAMPLES, k2c);
+    }
+    report("conversion(float[])  ", start);
+
+    start = benchClock::now();
+    for (uint8_t round = 0; round < ROUNDS; round++)
+    {
+        conversion(&inputFixed[0], &outputFixed[0], TOTAL_SAMPLES, k2c, 8);
+    }
+    report("conversion(int32_t[])", start);
+
+    // Same results, including the remaining values after the last block of 4
+    conversion(&input[0], &output[0], TOTAL_SAMPLES - 3, k2c);
+    for (size_t index = 0; index < TOTAL_SAMPLES - 3; index += 997)
+    {
+        TEST_NEAR(output[index], reference[index], 1e-4);
+        TEST_NEAR(outputFixed[index] / 256.0, inputFixed[index] / 256.0 - 273.15, 1.0 / 256.0);
+    }
+    return testResult("bench_units");
+}
@@ -0,0 +1,86 @@
+//
+// Arduino.h
+// Host mock of the core library, for the tests only
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// Time is simulated: delay() advances the clock, millis() and micros() advance it by 10 µs per call.
+//
+
+#ifndef Mock_Arduino_h
+#define Mock_Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define DEC 10
+#define HEX 16
+#define PUSH1 17
+
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+
+// Heap-free build only, no String
+class String;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int digitalPinToInterrupt(int pin);
+void attachInterrupt(uint8_t pin, void (*function)(void), int mode);
+void detachInterrupt(uint8_t pin);
+void noInterrupts();
+void interrupts();
+
+class Print
+{
+  public:
+    size_t write(const uint8_t * buffer, size_t size);
+    size_t print(const char * text);
+    size_t print(float value);
+    size_t print(uint32_t value, int base = DEC);
+    size_t println(const char * text = "");
+    size_t println(float value);
+    size_t println(uint32_t value, int base = DEC);
+};
+
+class HardwareSerial : public Print
+{
+  public:
+    void begin(uint32_t speed);
+};
+
+extern HardwareSerial Serial;
+
+// Test helpers
+void mockAdvance(uint32_t us); ///< advance the simulated clock
+void mockInterrupt(uint8_t pin); ///< call the function attached to the pin
+
+#endif
@@ -0,0 +1,15 @@
+//
+// Energia.h
+// Host mock of the core library, for the tests only
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+
+#include "Arduino.h"
@@ -0,0 +1,241 @@
+//
+// Mock.cpp
+// Host mock of the core and I2C libraries, for the tests only
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+
+#include "Arduino.h"
+#include "Wire.h"
+
+// Core
+static uint64_t clockMicros = 0;
+static void (*interruptFunctions[64])(void);
+
+HardwareSerial Serial;
+TwoWire Wire;
+
+void mockAdvance(uint32_t us)
+{
+    clockMicros += us;
+}
+
+uint32_t millis()
+{
+    clockMicros += 10;
+    return (uint32_t)(clockMicros / 1000);
+}
+
+uint32_t micros()
+{
+    clockMicros += 10;
+    return (uint32_t)clockMicros;
+}
+
+void delay(uint32_t ms)
+{
+    clockMicros += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    clockMicros += us;
+}
+
+void pinMode(uint8_t, uint8_t) { }
+void digitalWrite(uint8_t, uint8_t) { }
+int digitalRead(uint8_t) { return HIGH; }
+int digitalPinToInterrupt(int pin) { return pin; }
+void noInterrupts() { }
+void interrupts() { }
+
+void attachInterrupt(uint8_t pin, void (*function)(void), int)
+{
+    interruptFunctions[pin & 63] = function;
+}
+
+void detachInterrupt(uint8_t pin)
+{
+    interruptFunctions[pin & 63] = 0;
+}
+
+void mockInterrupt(uint8_t pin)
+{
+    if (interruptFunctions[pin & 63] != 0)
+    {
+        interruptFunctions[pin & 63]();
+    }
+}
+
+size_t Print::write(const uint8_t *, size_t size) { return size; }
+size_t Print::print(const char *) { return 0; }
+size_t Print::print(float) { return 0; }
+size_t Print::print(uint32_t, int) { return 0; }
+size_t Print::println(const char *) { return 0; }
+size_t Print::println(float) { return 0; }
+size_t Print::println(uint32_t, int) { return 0; }
+void HardwareSerial::begin(uint32_t) { }
+
+// I2C
+struct device_s
+{
+    bool present;
+    bool words;
+    uint8_t pointer;
+    uint16_t registers[256];
+};
+
+static device_s devices[128];
+static uint8_t current = 0;
+static uint8_t written = 0; ///< bytes written in the current transmission
+static uint8_t pending = 0; ///< high byte of a 16-bit write
+static uint8_t received[64];
+static uint8_t receivedLength = 0;
+static uint8_t receivedIndex = 0;
+static void (*readFunction)(uint8_t address, uint8_t command) = 0;
+static uint32_t busTransactions = 0;
+static uint32_t busBytes = 0; ///< 9 clocks each, with the acknowledge
+
+void mockReset()
+{
+    memset(devices, 0, sizeof(devices));
+    readFunction = 0;
+    mockBusReset();
+}
+
+void mockBusReset()
+{
+    busTransactions = 0;
+    busBytes = 0;
+}
+
+uint32_t mockBusTransactions()
+{
+    return busTransactions;
+}
+
+uint32_t mockBusBytes()
+{
+    return busBytes;
+}
+
+void mockOnRead(void (*function)(uint8_t address, uint8_t command))
+{
+    readFunction = function;
+}
+
+void mockDevice(uint8_t address, bool words)
+{
+    devices[address & 0x7f].present = true;
+    devices[address & 0x7f].words = words;
+}
+
+void mockRegister(uint8_t address, uint8_t command, uint16_t value)
+{
+    devices[address & 0x7f].registers[command] = value;
+}
+
+uint16_t mockRegisterValue(uint8_t address, uint8_t command)
+{
+    return devices[address & 0x7f].registers[command];
+}
+
+void TwoWire::begin() { }
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+    current = address & 0x7f;
+    written = 0;
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+    device_s * device = &devices[current];
+
+    if (written == 0)
+    {
+        device->pointer = data;
+    }
+    else if (device->words)
+    {
+        if (written & 1)
+        {
+            pending = data;
+        }
+        else
+        {
+            device->registers[device->pointer] = (pending << 8) | data;
+        }
+    }
+    else
+    {
+        device->registers[device->pointer++] = data;
+    }
+    written++;
+    return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool)
+{
+    busTransactions++;
+    busBytes += 1 + written;
+
+    // 2 = address not acknowledged
+    return devices[current].present ? 0 : 2;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, uint8_t)
+{
+    device_s * device = &devices[address & 0x7f];
+
+    busTransactions++;
+    busBytes += 1 + (device->present ? quantity : 0);
+
+    if (device->present and (readFunction != 0))
+    {
+        readFunction(address & 0x7f, device->pointer);
+    }
+    if (quantity > sizeof(received))
+    {
+        quantity = sizeof(received);
+    }
+    for (uint8_t index = 0; index < quantity; index++)
+    {
+        if (not device->present)
+        {
+            received[index] = 0xff;
+        }
+        else if (device->words)
+        {
+            // No auto-increment, the same register is read again
+            uint16_t value = device->registers[device->pointer];
+            received[index] = (index & 1) ? lowByte(value) : highByte(value);
+        }
+        else
+        {
+            received[index] = device->registers[(uint8_t)(device->pointer + index)];
+        }
+    }
+    receivedLength = quantity;
+    receivedIndex = 0;
+
+    // The library waits on available(), so bytes are always provided
+    return device->present ? quantity : 0;
+}
+
+int TwoWire::available()
+{
+    return receivedLength - receivedIndex;
+}
+
+int TwoWire::read()
+{
+    return (receivedIndex < receivedLength) ? received[receivedIndex++] : -1;
+}
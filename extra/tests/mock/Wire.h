@@ -0,0 +1,48 @@
+//
+// Wire.h
+// Host mock of the I2C library, for the tests only
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// Each simulated device is a set of 256 registers, either 16-bit MSB first (TI)
+// or 8-bit with auto-increment (Bosch, HDC2080). Absent devices do not acknowledge
+// and read as 0xff.
+//
+
+#ifndef Mock_Wire_h
+#define Mock_Wire_h
+
+#include "Arduino.h"
+
+class TwoWire
+{
+  public:
+    void begin();
+    void beginTransmission(uint8_t address);
+    size_t write(uint8_t data);
+    uint8_t endTransmission(bool stop = true);
+    uint8_t requestFrom(uint8_t address, uint8_t quantity, uint8_t stop = true);
+    int available();
+    int read();
+};
+
+extern TwoWire Wire;
+
+// Test helpers
+void mockReset(); ///< remove all the devices
+void mockDevice(uint8_t address, bool words); ///< add a device, 16-bit or 8-bit registers
+void mockRegister(uint8_t address, uint8_t command, uint16_t value); ///< set a register
+uint16_t mockRegisterValue(uint8_t address, uint8_t command); ///< last value written or set
+void mockOnRead(void (*function)(uint8_t address, uint8_t command)); ///< called before each read, to simulate a device, NULL = none
+void mockBusReset(); ///< reset the bus counters
+uint32_t mockBusTransactions(); ///< transactions since mockBusReset(), writes and reads
+uint32_t mockBusBytes(); ///< bytes on the bus since mockBusReset(), address bytes included
+
+#endif
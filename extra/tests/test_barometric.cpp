@@ -0,0 +1,60 @@
+//
+// test_barometric.cpp
+// Error bounds of the barometric formula against pow()
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+
+#include "Test.h"
+#include "Sensor_Barometric.h"
+
+// Largest errors of the float and fixed-point variants, in metre
+static void measure(Barometric_Formula & formula, double from, double to, double & error, double & errorFixed)
+{
+    error = 0;
+    errorFixed = 0;
+    for (double altitude = from; altitude <= to; altitude += 0.05)
+    {
+        double pressure = 1013.25 * pow(1.0 - altitude / BAROMETRIC_ALTITUDE, 1.0 / BAROMETRIC_EXPONENT);
+        double expected = BAROMETRIC_ALTITUDE * (1.0 - pow(pressure / 1013.25, BAROMETRIC_EXPONENT));
+        double value = formula.altitude(pressure);
+        double valueFixed = formula.altitudeFixed((uint32_t)(pressure * 25600.0 + 0.5)) / 1000.0;
+        error = fmax(error, fabs(value - expected));
+        errorFixed = fmax(errorFixed, fabs(valueFixed - expected));
+    }
+}
+
+int main()
+{
+    Barometric_Formula formula;
+    double error;
+    double errorFixed;
+
+    measure(formula, -500.0, 3000.0, error, errorFixed);
+    printf("-500..3000 m: %.4f m, fixed-point %.4f m\n", error, errorFixed);
+    TEST_CHECK(error < 0.012);
+    TEST_CHECK(errorFixed < 0.012);
+
+    measure(formula, -500.0, 5500.0, error, errorFixed);
+    printf("-500..5500 m: %.4f m, fixed-point %.4f m\n", error, errorFixed);
+    TEST_CHECK(error < 0.025);
+    TEST_CHECK(errorFixed < 0.025);
+
+    measure(formula, -500.0, 9000.0, error, errorFixed);
+    printf("-500..9000 m: %.4f m, fixed-point %.4f m\n", error, errorFixed);
+    TEST_CHECK(error < 0.09);
+    TEST_CHECK(errorFixed < 0.09);
+
+    // Cached reference
+    formula.setReference(1000.0, 120.0);
+    TEST_NEAR(formula.altitude(1000.0), 120.0, 0.012);
+
+    return testResult("test_barometric");
+}
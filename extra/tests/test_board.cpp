@@ -0,0 +1,79 @@
+//
+// test_board.cpp
+// Board profile validation, on a simulated bus
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+
+#include <string.h>
+#include "Test.h"
+#include "Wire.h"
+#include "Sensor_Board.h"
+
+// Cached profile accepted, any corruption rejected
+static void testRestore()
+{
+    Sensor_Board myBoard;
+    mockReset();
+    // OPT3001 at 0x44, as on the BASS and LaunchPad SensorTag Kit boards
+    mockDevice(0x44, true);
+    mockRegister(0x44, 0x7e, 0x5449);
+    mockRegister(0x44, 0x7f, 0x3001);
+    myBoard.probe();
+    TEST_CHECK(myBoard.address(SENSOR_DEVICE_OPT3001) == 0x44);
+
+    board_profile_s cached = *myBoard.profile();
+    Sensor_Board otherBoard;
+    TEST_CHECK(otherBoard.restore(&cached));
+    TEST_CHECK(otherBoard.address(SENSOR_DEVICE_OPT3001) == 0x44);
+
+    // Every single-bit error of the checked bytes
+    uint32_t accepted = 0;
+    for (uint8_t bit = 0; bit < 8; bit++)
+    {
+        board_profile_s corrupted = cached;
+        corrupted.sensors[0].address ^= 1 << bit;
+        accepted += otherBoard.restore(&corrupted);
+        corrupted = cached;
+        corrupted.board ^= 1 << bit;
+        accepted += otherBoard.restore(&corrupted);
+        corrupted = cached;
+        corrupted.magic ^= 1 << bit;
+        accepted += otherBoard.restore(&corrupted);
+    }
+    TEST_CHECK(accepted == 0);
+
+    // Blank and random memory
+    board_profile_s blank;
+    memset(&blank, 0x00, sizeof(blank));
+    TEST_CHECK(not otherBoard.restore(&blank));
+    memset(&blank, 0xff, sizeof(blank));
+    TEST_CHECK(not otherBoard.restore(&blank));
+
+    uint32_t seed = 12345;
+    accepted = 0;
+    for (uint32_t trial = 0; trial < 100000; trial++)
+    {
+        uint8_t * bytes = (uint8_t *)&blank;
+        for (uint8_t index = 0; index < sizeof(blank); index++)
+        {
+            seed = seed * 1664525 + 1013904223;
+            bytes[index] = seed >> 24;
+        }
+        accepted += otherBoard.restore(&blank);
+    }
+    TEST_CHECK(accepted == 0);
+}
+
+int main()
+{
+    testRestore();
+    return testResult("test_board");
+}
@@ -0,0 +1,215 @@
+//
+// test_hdc2080.cpp
+// HDC2080 thresholds, auto-measurement start, offsets and bus time, on a simulated device
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+
+#include "Test.h"
+#include "Wire.h"
+#include "Sensor_HDC2080.h"
+#include "Wire_Utilities.h"
+
+#define ADDRESS HDC2080_I2C_ADDRESS
+
+// Register values
+#define TEMPERATURE_THR_L 0x0a
+#define TEMPERATURE_THR_H 0x0b
+#define HUMIDITY_THR_L 0x0c
+#define HUMIDITY_THR_H 0x0d
+#define MEASURE_CONFIGURATION 0x0f
+#define TEMPERATURE_OFFSET_ADJUST 0x08
+#define HUMIDITY_OFFSET_ADJUST 0x09
+
+// Tables 8.6.9 and 8.6.10, weights of bits 7..0 as printed in the data-sheet
+static const float temperatureWeights[8] = { -20.62, 10.32, 5.16, 2.58, 1.28, 0.64, 0.32, 0.16 };
+static const float humidityWeights[8] = { -25.0, 12.5, 6.3, 3.1, 1.6, 0.8, 0.4, 0.2 };
+
+static float offsetWeights(const float * weights, uint8_t code)
+{
+    float result = 0;
+    for (uint8_t bit = 0; bit < 8; bit++)
+    {
+        if (code & (0x80 >> bit))
+        {
+            result += weights[bit];
+        }
+    }
+    return result;
+}
+
+static void setMeasure(float temperature, float humidity)
+{
+    uint16_t rawTemperature = (uint16_t)((temperature + 40.0) / 165.0 * 65536.0);
+    uint16_t rawHumidity = (uint16_t)(humidity / 100.0 * 65536.0);
+    mockRegister(ADDRESS, 0x00, lowByte(rawTemperature));
+    mockRegister(ADDRESS, 0x01, highByte(rawTemperature));
+    mockRegister(ADDRESS, 0x02, lowByte(rawHumidity));
+    mockRegister(ADDRESS, 0x03, highByte(rawHumidity));
+    mockRegister(ADDRESS, 0x04, HDC2080_STATUS_DATA_READY);
+}
+
+static float thresholdTemperature(uint8_t command)
+{
+    return mockRegisterValue(ADDRESS, command) * 165.0 / 256.0 - 40.0;
+}
+
+static float thresholdHumidity(uint8_t command)
+{
+    return mockRegisterValue(ADDRESS, command) * 100.0 / 256.0;
+}
+
+// Band never narrower than requested, by less than one step
+static void testThresholds()
+{
+    Sensor_HDC2080 sensor;
+    mockReset();
+    mockDevice(ADDRESS, false);
+    setMeasure(25.0, 50.0);
+
+    sensor.begin();
+    sensor.setTemperatureBand(20.3, 29.7, 1.0);
+    sensor.setHumidityBand(30.1, 69.9, 2.0);
+    sensor.beginThreshold(0, HDC2080_ONE_HZ);
+
+    TEST_CHECK(thresholdTemperature(TEMPERATURE_THR_H) >= 29.7);
+    TEST_CHECK(thresholdTemperature(TEMPERATURE_THR_H) < 29.7 + 165.0 / 256.0);
+    TEST_CHECK(thresholdTemperature(TEMPERATURE_THR_L) <= 20.3);
+    TEST_CHECK(thresholdTemperature(TEMPERATURE_THR_L) > 20.3 - 165.0 / 256.0);
+    TEST_CHECK(thresholdHumidity(HUMIDITY_THR_H) >= 69.9);
+    TEST_CHECK(thresholdHumidity(HUMIDITY_THR_L) <= 30.1);
+    TEST_CHECK(sensor.temperatureBand() == HDC2080_BAND_IN);
+
+    // Above the band, re-armed to come back below high - hysteresis
+    setMeasure(30.5, 50.0);
+    mockRegister(ADDRESS, 0x04, HDC2080_STATUS_TEMPERATURE_HIGH);
+    TEST_CHECK(sensor.event() == HDC2080_STATUS_TEMPERATURE_HIGH);
+    TEST_CHECK(sensor.temperatureBand() == HDC2080_BAND_ABOVE);
+    TEST_CHECK(thresholdTemperature(TEMPERATURE_THR_L) <= 29.7 - 1.0);
+
+    // Flag read and cleared by get() is still reported by event()
+    setMeasure(35.0, 50.0);
+    mockRegister(ADDRESS, 0x04, HDC2080_STATUS_TEMPERATURE_HIGH);
+    sensor.get();
+    mockRegister(ADDRESS, 0x04, 0x00);
+    TEST_CHECK(sensor.event() == HDC2080_STATUS_TEMPERATURE_HIGH);
+    TEST_CHECK(sensor.event() == 0);
+}
+
+// All the codes round trip and match the data-sheet bit weights
+// The printed weights are rounded: 0.16 °C for 165 / 1024 and 0.2 % for 100 / 512
+static void testOffsets()
+{
+    Sensor_HDC2080 sensor;
+    mockReset();
+    mockDevice(ADDRESS, false);
+
+    for (uint16_t code = 0; code < 256; code++)
+    {
+        // Decode
+        mockRegister(ADDRESS, TEMPERATURE_OFFSET_ADJUST, code);
+        mockRegister(ADDRESS, HUMIDITY_OFFSET_ADJUST, code);
+        float temperature = sensor.temperatureOffset();
+        float humidity = sensor.humidityOffset();
+        TEST_NEAR(temperature, offsetWeights(temperatureWeights, code), 0.02);
+        TEST_NEAR(humidity, offsetWeights(humidityWeights, code), 0.125);
+
+        // Encode the decoded value, exact
+        mockRegister(ADDRESS, TEMPERATURE_OFFSET_ADJUST, 0);
+        mockRegister(ADDRESS, HUMIDITY_OFFSET_ADJUST, 0);
+        TEST_CHECK(sensor.setTemperatureOffset(temperature));
+        TEST_CHECK(sensor.setHumidityOffset(humidity));
+        TEST_CHECK(mockRegisterValue(ADDRESS, TEMPERATURE_OFFSET_ADJUST) == code);
+        TEST_CHECK(mockRegisterValue(ADDRESS, HUMIDITY_OFFSET_ADJUST) == code);
+
+        // Encode the data-sheet value, within the rounding of the printed weights
+        sensor.setTemperatureOffset(offsetWeights(temperatureWeights, code));
+        TEST_CHECK(mockRegisterValue(ADDRESS, TEMPERATURE_OFFSET_ADJUST) == code);
+        sensor.setHumidityOffset(offsetWeights(humidityWeights, code));
+        TEST_CHECK(abs((int8_t)mockRegisterValue(ADDRESS, HUMIDITY_OFFSET_ADJUST) - (int8_t)code) <= 1);
+    }
+
+    // Saturation beyond the range
+    sensor.setTemperatureOffset(30.0);
+    TEST_CHECK(mockRegisterValue(ADDRESS, TEMPERATURE_OFFSET_ADJUST) == 0x7f);
+    sensor.setHumidityOffset(-30.0);
+    TEST_CHECK(mockRegisterValue(ADDRESS, HUMIDITY_OFFSET_ADJUST) == 0x80);
+}
+
+// Single burst against one read per register, as before the burst
+static void testBusTime()
+{
+    Sensor_HDC2080 sensor;
+    mockReset();
+    mockDevice(ADDRESS, false);
+    setMeasure(25.0, 50.0);
+
+    mockBusReset();
+    readRegister16(ADDRESS, 0x02, LSBFIRST);
+    readRegister16(ADDRESS, 0x00, LSBFIRST);
+    uint32_t registerTransactions = mockBusTransactions();
+    uint32_t registerBytes = mockBusBytes();
+
+    mockBusReset();
+    sensor.get();
+    uint32_t burstTransactions = mockBusTransactions();
+    uint32_t burstBytes = mockBusBytes();
+
+    mockBusReset();
+    sensor.get(true);
+    uint32_t maximumTransactions = mockBusTransactions();
+    uint32_t maximumBytes = mockBusBytes();
+
+    printf("per register: %u transactions, %u bytes\n", registerTransactions, registerBytes);
+    printf("get(): %u transactions, %u bytes, with status\n", burstTransactions, burstBytes);
+    printf("get(true): %u transactions, %u bytes, with status and maximum\n", maximumTransactions, maximumBytes);
+
+    TEST_CHECK(registerTransactions == 4);
+    TEST_CHECK(burstTransactions == 2);
+    TEST_CHECK(maximumTransactions == 2);
+    TEST_CHECK(burstBytes < registerBytes);
+    TEST_CHECK(maximumBytes <= registerBytes);
+}
+
+// Rate alone does not start the auto-measurement
+static void testTrigger()
+{
+    Sensor_HDC2080 sensor;
+    mockReset();
+    mockDevice(ADDRESS, false);
+    setMeasure(25.0, 50.0);
+
+    sensor.begin();
+    mockRegister(ADDRESS, MEASURE_CONFIGURATION, 0x00);
+    sensor.beginAutoMeasurement(HDC2080_ONE_HZ);
+    TEST_CHECK(mockRegisterValue(ADDRESS, MEASURE_CONFIGURATION) & 0x01);
+
+    mockRegister(ADDRESS, MEASURE_CONFIGURATION, 0x00);
+    sensor.beginDataReady(0, HDC2080_ONE_HZ);
+    TEST_CHECK(mockRegisterValue(ADDRESS, MEASURE_CONFIGURATION) & 0x01);
+    sensor.endDataReady();
+
+    // No data ready: bounded wait
+    mockRegister(ADDRESS, MEASURE_CONFIGURATION, 0x00);
+    mockRegister(ADDRESS, 0x04, 0x00);
+    uint32_t chrono = millis();
+    sensor.beginThreshold(0, HDC2080_ONE_HZ);
+    TEST_CHECK(mockRegisterValue(ADDRESS, MEASURE_CONFIGURATION) & 0x01);
+    TEST_CHECK(millis() - chrono <= 2 * ((sensor.conversionTime() + 999) / 1000) + 2);
+}
+
+int main()
+{
+    testThresholds();
+    testTrigger();
+    testOffsets();
+    testBusTime();
+    return testResult("test_hdc2080");
+}
@@ -0,0 +1,273 @@
+//
+// test_heap_free.cpp
+// Heap-free build: no function of the library allocates memory
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// malloc() and operator new are replaced and count the allocations
+// made while the library runs against the simulated devices.
+//
+
+#include <new>
+#include "Test.h"
+#include "Wire.h"
+#include "Sensor_Units.h"
+#include "Sensor_Interface.h"
+#include "Sensor_Calibration.h"
+#include "Sensor_Barometric.h"
+#include "Sensor_Variometer.h"
+#include "Sensor_Scheduler.h"
+#include "Sensor_Snapshot.h"
+#include "Sensor_History.h"
+#include "Sensor_Board.h"
+#include "Sensor_Startup.h"
+
+#if (SENSOR_HEAP_FREE != 1)
+#error Build with SENSOR_HEAP_FREE=1
+#endif
+
+// Allocation counter
+static bool tracking = false;
+static int allocations = 0;
+
+extern "C" void * __libc_malloc(size_t size);
+extern "C" void * __libc_calloc(size_t count, size_t size);
+extern "C" void * __libc_realloc(void * pointer, size_t size);
+extern "C" void __libc_free(void * pointer);
+
+extern "C" void * malloc(size_t size)
+{
+    if (tracking)
+    {
+        allocations++;
+    }
+    return __libc_malloc(size);
+}
+
+extern "C" void * calloc(size_t count, size_t size)
+{
+    if (tracking)
+    {
+        allocations++;
+    }
+    return __libc_calloc(count, size);
+}
+
+extern "C" void * realloc(void * pointer, size_t size)
+{
+    if (tracking)
+    {
+        allocations++;
+    }
+    return __libc_realloc(pointer, size);
+}
+
+extern "C" void free(void * pointer)
+{
+    __libc_free(pointer);
+}
+
+void * operator new(size_t size)
+{
+    if (tracking)
+    {
+        allocations++;
+    }
+    void * pointer = __libc_malloc(size);
+    if (pointer == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void * operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void * pointer) noexcept
+{
+    __libc_free(pointer);
+}
+
+void operator delete[](void * pointer) noexcept
+{
+    __libc_free(pointer);
+}
+
+void operator delete(void * pointer, size_t) noexcept
+{
+    __libc_free(pointer);
+}
+
+void operator delete[](void * pointer, size_t) noexcept
+{
+    __libc_free(pointer);
+}
+
+// Drivers, as global objects on the MCU
+Sensor_TMP007 myTMP007;
+Sensor_TMP116 myTMP116;
+Sensor_HDC1000 myHDC1000;
+Sensor_HDC2080 myHDC2080;
+Sensor_OPT3001 myOPT3001;
+Sensor_BMP280 myBMP280;
+Sensor_BME280 myBME280;
+
+Sensor_Adapter<Sensor_TMP007> myTMP007Adapter(myTMP007);
+Sensor_Adapter<Sensor_TMP116> myTMP116Adapter(myTMP116);
+Sensor_Adapter<Sensor_HDC1000> myHDC1000Adapter(myHDC1000);
+Sensor_Adapter<Sensor_HDC2080> myHDC2080Adapter(myHDC2080);
+Sensor_Adapter<Sensor_OPT3001> myOPT3001Adapter(myOPT3001);
+Sensor_Adapter<Sensor_BME280> myBME280Adapter(myBME280);
+
+Sensor_Interface * mySensors[] =
+{
+    &myTMP007Adapter, &myTMP116Adapter, &myHDC1000Adapter,
+    &myHDC2080Adapter, &myOPT3001Adapter, &myBME280Adapter
+};
+
+Calibration_Table myCalibration;
+Barometric_Formula myBarometric;
+Barometric_Variometer myVariometer;
+Sensor_Scheduler myScheduler;
+Sensor_Snapshot mySnapshot;
+Sensor_History<16> myHistory;
+Sensor_Board myBoard;
+Sensor_Startup myStartup;
+
+static void setupDevices()
+{
+    mockReset();
+
+    mockDevice(TMP007_SLAVE_ADDRESS, true);
+    mockRegister(TMP007_SLAVE_ADDRESS, 0xff, 0x0078);
+    mockDevice(TMP116_SLAVE_ADDRESS, true);
+    mockRegister(TMP116_SLAVE_ADDRESS, 0x0f, 0x1116);
+    mockDevice(HDC1000_I2C_ADDRESS, true);
+    mockRegister(HDC1000_I2C_ADDRESS, 0xff, 0x1000);
+    mockDevice(HDC2080_I2C_ADDRESS, false);
+    mockRegister(HDC2080_I2C_ADDRESS, 0xfe, 0xd0);
+    mockRegister(HDC2080_I2C_ADDRESS, 0xff, 0x07);
+    mockDevice(OPT3001_SLAVE_ADDRESS, true);
+    mockRegister(OPT3001_SLAVE_ADDRESS, 0x7f, 0x3001);
+    mockDevice(BME280_SLAVE_ADDRESS, false);
+    mockRegister(BME280_SLAVE_ADDRESS, 0xd0, 0x60);
+}
+
+static void runLibrary()
+{
+    char buffer[64];
+    volatile float value = 0;
+
+    // Drivers
+    myTMP007.begin();
+    myTMP007.get();
+    value += myTMP007.internal() + myTMP007.external();
+    myTMP007.beginResume();
+
+    myTMP116.begin();
+    myTMP116.get();
+    value += myTMP116.temperature();
+    myTMP116.beginSaved();
+
+    myHDC1000.begin();
+    myHDC1000.get();
+    value += myHDC1000.temperature() + myHDC1000.humidity();
+
+    myHDC2080.begin();
+    myHDC2080.get();
+    value += myHDC2080.temperature() + myHDC2080.humidity();
+    myHDC2080.beginResume();
+
+    myOPT3001.begin();
+    myOPT3001.get();
+    value += myOPT3001.light();
+
+    myBMP280.begin();
+    myBMP280.get();
+    value += myBMP280.altitude(1013.25);
+
+    myBME280.begin();
+    myBME280.get();
+    value += myBME280.altitude(1000.0, 120.0);
+    myBME280.beginResume();
+
+    // Identification, const char * in the heap-free build
+    const char * names[] =
+    {
+        myTMP007.WhoAmI(), myTMP116.WhoAmI(), myHDC1000.WhoAmI(), myHDC2080.WhoAmI(),
+        myOPT3001.WhoAmI(), myBMP280.WhoAmI(), myBME280.WhoAmI()
+    };
+    TEST_CHECK(names[0] != NULL);
+
+    // Formatting
+    formatUnit(buffer, sizeof(buffer), 21.5, CELSIUS, 1);
+    Units_Line line(buffer, sizeof(buffer));
+    line.add("temperature", 294.65, KELVIN);
+    line.end();
+
+    // Calibration
+    const int32_t measured[2] = { 0, 1000 };
+    const int32_t reference[2] = { 10, 1010 };
+    myCalibration.set(measured, reference, 2);
+    uint8_t blob[CALIBRATION_BLOB_SIZE];
+    myCalibration.deserialise(blob, myCalibration.serialise(blob, sizeof(blob)));
+    myTMP116.setCalibration(&myCalibration);
+    myTMP116.get();
+
+    // Barometric formula and variometer
+    value += myBarometric.altitude(1000.0) + myBarometric.altitudeFixed(25600000);
+    myVariometer.update(1000.0, 20000);
+    myVariometer.update(999.9, 40000);
+    value += myVariometer.verticalSpeed();
+
+    // Scheduler, snapshot and history
+    uint8_t first = 0;
+    for (uint8_t index = 0; index < sizeof(mySensors) / sizeof(mySensors[0]); index++)
+    {
+        myScheduler.add(mySensors[index], 100 * (index + 1));
+    }
+    myScheduler.begin();
+    for (uint8_t count = 0; count < 12; count++)
+    {
+        uint8_t task = myScheduler.run();
+        if (task != SCHEDULER_NONE)
+        {
+            first = mySnapshot.update(first % 8, myScheduler.sensor(task), myScheduler.result(task), millis());
+            mySnapshot.publish();
+            myHistory.push(myScheduler.sensor(task)->raw(0), millis());
+        }
+    }
+    sensor_snapshot_s snapshot;
+    mySnapshot.read(snapshot);
+    history_sample_s<int16_t> sample;
+    myHistory.pop(sample);
+
+    // Board and start-up
+    myBoard.probe();
+    myBoard.restore(myBoard.profile());
+    myStartup.after(myTMP007.beginReset());
+    myStartup.wait();
+}
+
+int main()
+{
+    setupDevices();
+
+    tracking = true;
+    runLibrary();
+    tracking = false;
+
+    printf("allocations: %d\n", allocations);
+    TEST_CHECK(allocations == 0);
+    return testResult("test_heap_free");
+}
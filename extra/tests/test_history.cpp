@@ -0,0 +1,196 @@
+//
+// test_history.cpp
+// Sensor_History indexes, policies and a concurrent producer
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+
+#include <thread>
+#include <atomic>
+#include "Test.h"
+#include "Sensor_History.h"
+
+#define SAMPLES 200000
+
+// first() and peek() share the free-running indexes, also across their wrap
+static void testIndexes()
+{
+    Sensor_History<16, int32_t> history;
+    history_sample_s<int32_t> sample;
+
+    TEST_CHECK(history.first(0) == 0);
+    TEST_CHECK(not history.peek(history.first(0), sample));
+
+    // Far beyond 65536 samples: indexes wrap, samples are overwritten
+    for (uint32_t index = 0; index < 70000; index++)
+    {
+        history.push((int32_t)index, index * 10);
+    }
+    TEST_CHECK(history.available() == history.capacity());
+
+    uint16_t index = history.first(699955);
+    TEST_CHECK(index == (uint16_t)69996);
+    TEST_CHECK(history.peek(index, sample));
+    TEST_CHECK(sample.timestamp == 699960);
+    TEST_CHECK(history.peek(index - 1, sample) and (sample.timestamp == 699950));
+
+    uint16_t count = 0;
+    for (index = history.first(699955); history.peek(index, sample); index++)
+    {
+        TEST_CHECK(sample.value == (int32_t)(sample.timestamp / 10));
+        count++;
+    }
+    TEST_CHECK(count == 4);
+
+    // Window before the oldest sample, after the newest one
+    TEST_CHECK(history.first(0) == (uint16_t)(70000 - history.capacity()));
+    TEST_CHECK(history.first(800000) == (uint16_t)70000);
+    TEST_CHECK(not history.peek(history.first(800000), sample));
+
+    // Overwritten index is rejected, even if still inside the storage
+    index = history.first(699955);
+    for (uint8_t i = 0; i < 16; i++)
+    {
+        history.push(0, 700000);
+    }
+    TEST_CHECK(not history.peek(index, sample));
+
+    // Index stays valid across pop()
+    history.clear();
+    history.push(1, 1000);
+    history.push(2, 2000);
+    index = history.first(2000);
+    TEST_CHECK(history.pop(sample) and (sample.value == 1));
+    TEST_CHECK(history.peek(index, sample) and (sample.value == 2));
+}
+
+// HISTORY_DROP_NEWEST keeps the oldest samples
+static void testDrop()
+{
+    Sensor_History<16, int32_t> history(HISTORY_DROP_NEWEST);
+    history_sample_s<int32_t> sample;
+
+    for (int32_t index = 0; index < 20; index++)
+    {
+        history.push(index, index * 10);
+    }
+    TEST_CHECK(history.available() == 16);
+    TEST_CHECK(history.lost() == 4);
+    TEST_CHECK(history.peek(history.first(55), sample) and (sample.timestamp == 60));
+}
+
+static Sensor_History<64, int32_t> myHistory;
+static std::atomic<bool> done(false);
+static std::atomic<bool> started(false);
+
+// Once the buffer is full, the producer waits for a first window,
+// so the test does not depend on the scheduling of the threads
+static void producer()
+{
+    for (uint32_t index = 1; index <= SAMPLES; index++)
+    {
+        myHistory.push((int32_t)index, index);
+
+        while ((index >= 64) and (not started))
+        {
+            std::this_thread::yield();
+        }
+    }
+    done = true;
+}
+
+// Window starting 16 ms after the oldest sample, checked around its first sample
+static bool window(uint32_t & wrong)
+{
+    history_sample_s<int32_t> sample;
+    uint32_t start = 0;
+    if (myHistory.peek(myHistory.first(0), sample))
+    {
+        start = sample.timestamp + 16;
+    }
+
+    uint16_t index = myHistory.first(start);
+    if (not myHistory.peek(index, sample))
+    {
+        return false;
+    }
+
+    wrong += (sample.value != (int32_t)sample.timestamp) or (sample.timestamp < start);
+    if (myHistory.peek(index - 1, sample))
+    {
+        wrong += (sample.value != (int32_t)sample.timestamp) or (sample.timestamp >= start);
+    }
+    return true;
+}
+
+// Concurrent producer: first() and peek() never return an overwritten sample
+static void testConcurrent()
+{
+    uint32_t windows = 0;
+    uint32_t wrong = 0;
+    history_sample_s<int32_t> sample;
+
+    std::thread thread(producer);
+    while (not done)
+    {
+        if (window(wrong))
+        {
+            windows++;
+            started = true;
+        }
+    }
+    thread.join();
+
+    // Last window, producer stopped
+    TEST_CHECK(window(wrong));
+    TEST_CHECK(myHistory.peek(myHistory.first(SAMPLES), sample) and (sample.value == SAMPLES));
+    TEST_CHECK(windows > 0);
+    TEST_CHECK(wrong == 0);
+
+    // Consumer draining while the producer runs: order kept, none lost unaccounted
+    // The producer is paced, as lost() is exact only within 65536 samples between two polls
+    Sensor_History<64, int32_t> history;
+    uint32_t popped = 0;
+    int32_t last = 0;
+    wrong = 0;
+    done = false;
+
+    std::thread filler([&history]()
+    {
+        for (uint32_t index = 1; index <= SAMPLES; index++)
+        {
+            history.push((int32_t)index, index);
+            for (volatile uint16_t pace = 0; pace < 200; pace++);
+        }
+        done = true;
+    });
+    while ((not done) or (history.available() > 0))
+    {
+        if (history.pop(sample))
+        {
+            popped++;
+            wrong += (sample.value != (int32_t)sample.timestamp) or (sample.value <= last);
+            last = sample.value;
+        }
+    }
+    filler.join();
+
+    TEST_CHECK(wrong == 0);
+    TEST_CHECK(last == SAMPLES);
+    TEST_CHECK(popped + history.lost() == SAMPLES);
+}
+
+int main()
+{
+    testIndexes();
+    testDrop();
+    testConcurrent();
+    return testResult("test_history");
+}
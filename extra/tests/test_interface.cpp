@@ -0,0 +1,216 @@
+//
+// test_interface.cpp
+// Sensor_Traits raw values, results and conversion times, on simulated devices
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+
+#include "Test.h"
+#include "Wire.h"
+#include "Sensor_Interface.h"
+
+// Calibration and readings from the example of the BMP280 data-sheet, 25.08 °C and 100653.27 Pa
+static const int16_t calibration[12] = { 27504, 26435, -1000, (int16_t)36477, -10685, 3024, 2855, 140, -7, 15500, -14600, 6000 };
+
+static void setBosch(uint8_t address)
+{
+    mockDevice(address, false);
+    for (uint8_t index = 0; index < 12; index++)
+    {
+        mockRegister(address, 0x88 + 2 * index, lowByte((uint16_t)calibration[index]));
+        mockRegister(address, 0x89 + 2 * index, highByte((uint16_t)calibration[index]));
+    }
+    // adc_P = 415148, adc_T = 519888
+    mockRegister(address, 0xf7, 0x65);
+    mockRegister(address, 0xf8, 0x5a);
+    mockRegister(address, 0xf9, 0xc0);
+    mockRegister(address, 0xfa, 0x7e);
+    mockRegister(address, 0xfb, 0xed);
+    mockRegister(address, 0xfc, 0x00);
+}
+
+// Pressure above 2^24 LSB keeps its low bits
+static void testRawPressure()
+{
+    Sensor_BMP280 sensor;
+    typedef Sensor_Traits<Sensor_BMP280> traits;
+    mockReset();
+    setBosch(BMP280_SLAVE_ADDRESS);
+
+    sensor.begin();
+    // Normal mode, next conversion after conversion time and 0.5 ms standby
+    delay(7);
+    TEST_CHECK(traits::acquire(sensor) == SENSOR_FRESH);
+    TEST_CHECK(traits::raw(sensor, 1) == sensor.rawPressure());
+    TEST_CHECK(traits::raw(sensor, 1) > (1L << 24));
+    TEST_NEAR(traits::raw(sensor, 1) / 256.0, 100653.27, 0.5);
+    TEST_NEAR(traits::raw(sensor, 0) / 5120.0, 25.08, 0.01);
+    TEST_CHECK(traits::raw(sensor, 0) == sensor.rawTemperature());
+}
+
+// Oversampling x1, data-sheet formula
+static void testConversionTime()
+{
+    Sensor_BMP280 myBMP280;
+    Sensor_BME280 myBME280;
+
+    TEST_CHECK(Sensor_Traits<Sensor_BMP280>::conversionTime(myBMP280) == 6425);
+    TEST_CHECK(Sensor_Traits<Sensor_BME280>::conversionTime(myBME280) == 9300);
+}
+
+// A conversion is fresh only once
+static void testFreshOnce()
+{
+    Sensor_OPT3001 sensor;
+    typedef Sensor_Traits<Sensor_OPT3001> traits;
+    mockReset();
+    mockDevice(OPT3001_SLAVE_ADDRESS, true);
+
+    sensor.begin(OPT3001_100_MS_CONTINUOUS);
+    // Conversion ready, 2^3 x 0x123 x 0.01 lux
+    mockRegister(OPT3001_SLAVE_ADDRESS, 0x00, 0x3123);
+    mockRegister(OPT3001_SLAVE_ADDRESS, 0x01, OPT3001_100_MS_CONTINUOUS | 0x0080);
+    TEST_CHECK(traits::acquire(sensor) == SENSOR_FRESH);
+    TEST_CHECK(traits::raw(sensor, 0) == 8 * 0x123);
+
+    mockRegister(OPT3001_SLAVE_ADDRESS, 0x01, OPT3001_100_MS_CONTINUOUS);
+    TEST_CHECK(traits::acquire(sensor) == SENSOR_STALE);
+
+    // Overflow
+    mockRegister(OPT3001_SLAVE_ADDRESS, 0x01, OPT3001_100_MS_CONTINUOUS | 0x0180);
+    TEST_CHECK(traits::acquire(sensor) == SENSOR_ERROR);
+}
+
+// Previous conversion, or conversion still running, is stale
+static void testStale()
+{
+    mockReset();
+
+    // BMP280, normal mode, one conversion per period
+    Sensor_BMP280 myBMP280;
+    typedef Sensor_Traits<Sensor_BMP280> bmp280;
+    setBosch(BMP280_SLAVE_ADDRESS);
+    myBMP280.begin();
+    TEST_CHECK(bmp280::acquire(myBMP280) == SENSOR_STALE);
+    delay(7);
+    mockRegister(BMP280_SLAVE_ADDRESS, 0xf3, 0x08);
+    TEST_CHECK(bmp280::acquire(myBMP280) == SENSOR_STALE);
+    mockRegister(BMP280_SLAVE_ADDRESS, 0xf3, 0x00);
+    TEST_CHECK(bmp280::acquire(myBMP280) == SENSOR_FRESH);
+    TEST_CHECK(bmp280::acquire(myBMP280) == SENSOR_STALE);
+
+    // 62.5 ms standby
+    mockRegister(BMP280_SLAVE_ADDRESS, 0xf5, 0x20);
+    delay(7);
+    TEST_CHECK(bmp280::acquire(myBMP280) == SENSOR_STALE);
+    delay(63);
+    TEST_CHECK(bmp280::acquire(myBMP280) == SENSOR_FRESH);
+
+    // BME280, forced mode, one conversion per trigger
+    Sensor_BME280 myBME280;
+    typedef Sensor_Traits<Sensor_BME280> bme280;
+    setBosch(BME280_SLAVE_ADDRESS);
+    myBME280.begin();
+    TEST_CHECK(bme280::acquire(myBME280) == SENSOR_STALE);
+    bme280::trigger(myBME280);
+    mockRegister(BME280_SLAVE_ADDRESS, 0xf3, 0x08);
+    TEST_CHECK(bme280::acquire(myBME280) == SENSOR_STALE);
+    mockRegister(BME280_SLAVE_ADDRESS, 0xf3, 0x01);
+    TEST_CHECK(bme280::acquire(myBME280) == SENSOR_STALE);
+    mockRegister(BME280_SLAVE_ADDRESS, 0xf3, 0x00);
+    TEST_CHECK(bme280::acquire(myBME280) == SENSOR_FRESH);
+    TEST_CHECK(bme280::acquire(myBME280) == SENSOR_STALE);
+
+    // HDC2080, data ready flag, cleared on read by the device
+    Sensor_HDC2080 myHDC2080;
+    typedef Sensor_Traits<Sensor_HDC2080> hdc2080;
+    mockDevice(HDC2080_I2C_ADDRESS, false);
+    myHDC2080.begin();
+    mockRegister(HDC2080_I2C_ADDRESS, 0x04, 0x00);
+    TEST_CHECK(hdc2080::acquire(myHDC2080) == SENSOR_STALE);
+    hdc2080::trigger(myHDC2080);
+    mockRegister(HDC2080_I2C_ADDRESS, 0x04, HDC2080_STATUS_DATA_READY);
+    TEST_CHECK(hdc2080::acquire(myHDC2080) == SENSOR_FRESH);
+}
+
+// TMP007 data invalid flag of the status is an error
+static void testInvalid()
+{
+    Sensor_TMP007 sensor;
+    typedef Sensor_Traits<Sensor_TMP007> traits;
+    mockReset();
+    mockDevice(TMP007_SLAVE_ADDRESS, true);
+    sensor.begin();
+
+    // 25 °C, conversion ready
+    mockRegister(TMP007_SLAVE_ADDRESS, 0x03, (25 * 32) << 2);
+    mockRegister(TMP007_SLAVE_ADDRESS, 0x04, 0x4000);
+    TEST_CHECK(traits::acquire(sensor) == SENSOR_FRESH);
+    TEST_NEAR(sensor.external(), 298.15, 0.01);
+
+    // Conversion ready, data invalid
+    mockRegister(TMP007_SLAVE_ADDRESS, 0x03, (30 * 32) << 2);
+    mockRegister(TMP007_SLAVE_ADDRESS, 0x04, 0x4200);
+    TEST_CHECK(traits::acquire(sensor) == SENSOR_ERROR);
+    TEST_NEAR(sensor.external(), 298.15, 0.01);
+}
+
+// trigger() starts the conversion, acquire() only reads
+static void testTrigger()
+{
+    mockReset();
+
+    // BME280, forced mode
+    Sensor_BME280 myBME280;
+    setBosch(BME280_SLAVE_ADDRESS);
+    mockRegister(BME280_SLAVE_ADDRESS, 0xf4, 0x00);
+    Sensor_Traits<Sensor_BME280>::trigger(myBME280);
+    TEST_CHECK((mockRegisterValue(BME280_SLAVE_ADDRESS, 0xf4) & 0x03) == 0x01);
+    mockRegister(BME280_SLAVE_ADDRESS, 0xf4, 0x00);
+    Sensor_Traits<Sensor_BME280>::acquire(myBME280);
+    TEST_CHECK(mockRegisterValue(BME280_SLAVE_ADDRESS, 0xf4) == 0x00);
+
+    // HDC1000, one read per trigger
+    Sensor_HDC1000 myHDC1000;
+    mockDevice(HDC1000_I2C_ADDRESS, true);
+    myHDC1000.begin();
+    TEST_CHECK(Sensor_Traits<Sensor_HDC1000>::acquire(myHDC1000) == SENSOR_STALE);
+    Sensor_Traits<Sensor_HDC1000>::trigger(myHDC1000);
+    TEST_CHECK(Sensor_Traits<Sensor_HDC1000>::acquire(myHDC1000) == SENSOR_FRESH);
+    TEST_CHECK(Sensor_Traits<Sensor_HDC1000>::acquire(myHDC1000) == SENSOR_STALE);
+
+    // TMP116, one-shot
+    Sensor_TMP116 myTMP116;
+    mockDevice(TMP116_SLAVE_ADDRESS, true);
+    myTMP116.beginReset(TMP116_EIGHT_SAMPLES, TMP116_CONVERSION_1_SECOND, TMP116_MODE_ONCE);
+    myTMP116.beginConfigure();
+    TEST_CHECK((mockRegisterValue(TMP116_SLAVE_ADDRESS, 0x01) & 0x0c00) == TMP116_MODE_SHUTDOWN);
+    Sensor_Traits<Sensor_TMP116>::trigger(myTMP116);
+    TEST_CHECK((mockRegisterValue(TMP116_SLAVE_ADDRESS, 0x01) & 0x0c00) == TMP116_MODE_ONCE);
+
+    // OPT3001, single-shot
+    Sensor_OPT3001 myOPT3001;
+    mockDevice(OPT3001_SLAVE_ADDRESS, true);
+    myOPT3001.begin(OPT3001_100_MS_ONCE);
+    mockRegister(OPT3001_SLAVE_ADDRESS, 0x01, OPT3001_100_MS_OFF);
+    Sensor_Traits<Sensor_OPT3001>::trigger(myOPT3001);
+    TEST_CHECK(mockRegisterValue(OPT3001_SLAVE_ADDRESS, 0x01) == OPT3001_100_MS_ONCE);
+}
+
+int main()
+{
+    testRawPressure();
+    testConversionTime();
+    testFreshOnce();
+    testStale();
+    testInvalid();
+    testTrigger();
+    return testResult("test_interface");
+}
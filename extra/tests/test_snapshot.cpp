@@ -0,0 +1,98 @@
+//
+// test_snapshot.cpp
+// Sensor_Snapshot under a writer thread and a concurrent reader
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+
+#include <thread>
+#include <atomic>
+#include "Test.h"
+#include "Sensor_Snapshot.h"
+
+#define PUBLICATIONS 500000
+
+static Sensor_Snapshot mySnapshot;
+static std::atomic<bool> done(false);
+static std::atomic<bool> started(false);
+
+// All the channels of a publication carry its number
+// After the first publication, the writer waits for a first coherent read,
+// so the test does not depend on the scheduling of the threads
+static void writer()
+{
+    for (uint32_t publication = 1; publication <= PUBLICATIONS; publication++)
+    {
+        sensor_snapshot_s * snapshot = mySnapshot.edit();
+        snapshot->count = SNAPSHOT_CHANNELS;
+        for (uint8_t channel = 0; channel < SNAPSHOT_CHANNELS; channel++)
+        {
+            snapshot->channels[channel].raw = publication;
+            snapshot->channels[channel].value = publication;
+            snapshot->channels[channel].timestamp = publication;
+        }
+        mySnapshot.publish(publication);
+
+        while (not started)
+        {
+            std::this_thread::yield();
+        }
+    }
+    done = true;
+}
+
+// A coherent copy never mixes two publications
+static void testConcurrentRead()
+{
+    uint32_t coherent = 0;
+    uint32_t torn = 0;
+    uint32_t previous = 0;
+    uint32_t backwards = 0;
+
+    std::thread thread(writer);
+    while (not done)
+    {
+        sensor_snapshot_s snapshot;
+        if (not mySnapshot.read(snapshot))
+        {
+            continue;
+        }
+        coherent++;
+        started = true;
+
+        for (uint8_t channel = 0; channel < snapshot.count; channel++)
+        {
+            if ((snapshot.channels[channel].raw != (int32_t)snapshot.timestamp) or
+                    (snapshot.channels[channel].timestamp != snapshot.timestamp))
+            {
+                torn++;
+                break;
+            }
+        }
+        backwards += (snapshot.timestamp < previous);
+        previous = snapshot.timestamp;
+    }
+    thread.join();
+
+    TEST_CHECK(coherent > 0);
+    TEST_CHECK(torn == 0);
+    TEST_CHECK(backwards == 0);
+
+    sensor_snapshot_s snapshot;
+    TEST_CHECK(mySnapshot.read(snapshot));
+    TEST_CHECK(snapshot.timestamp == PUBLICATIONS);
+    TEST_CHECK(mySnapshot.sequence() == (uint8_t)PUBLICATIONS);
+}
+
+int main()
+{
+    testConcurrentRead();
+    return testResult("test_snapshot");
+}
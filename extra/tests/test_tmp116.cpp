@@ -0,0 +1,109 @@
+//
+// test_tmp116.cpp
+// TMP116 continuous conversions, on a simulated device
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+
+#include "Test.h"
+#include "Wire.h"
+#include "Sensor_TMP116.h"
+
+#define ADDRESS TMP116_SLAVE_ADDRESS
+#define TEMPERATURE 0x00
+#define CONFIGURATION 0x01
+
+// Simulated TMP116: first result after the averaging, then one per cycle,
+// data ready cleared on read of the configuration register
+static uint32_t startTime;
+static uint32_t averagingTime;
+static uint32_t cycleTime;
+static int32_t consumed;
+
+static void restart(uint32_t averaging, uint32_t cycle)
+{
+    startTime = millis();
+    averagingTime = averaging;
+    cycleTime = cycle;
+    consumed = -1;
+}
+
+static void onRead(uint8_t address, uint8_t command)
+{
+    if ((address != ADDRESS) or (command != CONFIGURATION))
+    {
+        return;
+    }
+
+    uint32_t elapsed = millis() - startTime;
+    int32_t completed = (elapsed < averagingTime) ? -1 : (int32_t)((elapsed - averagingTime) / cycleTime);
+    uint16_t configuration = mockRegisterValue(ADDRESS, CONFIGURATION) & ~TMP116_DATA_REDAY;
+
+    if (completed > consumed)
+    {
+        consumed = completed;
+        configuration |= TMP116_DATA_REDAY;
+        // 25 °C, then +1/128 °C per conversion
+        mockRegister(ADDRESS, TEMPERATURE, 25 * 128 + completed);
+    }
+    mockRegister(ADDRESS, CONFIGURATION, configuration);
+}
+
+// First result after the averaging time, not the cycle
+static void testFirstWait()
+{
+    Sensor_TMP116 sensor;
+    mockReset();
+    mockDevice(ADDRESS, true);
+    mockOnRead(onRead);
+
+    uint32_t period = sensor.beginReset(TMP116_EIGHT_SAMPLES, TMP116_CONVERSION_1_SECOND);
+    delay(period);
+    restart(125, 1000);
+    period = sensor.beginConfigure();
+    TEST_CHECK(period == 125);
+    TEST_CHECK(sensor.conversionTime() == 1000);
+
+    restart(125, 1000);
+    uint32_t chrono = millis();
+    sensor.begin(TMP116_EIGHT_SAMPLES, TMP116_CONVERSION_1_SECOND);
+    TEST_CHECK(millis() - chrono < 250);
+    TEST_NEAR(sensor.temperature(), 25.0 + 273.15, 0.001);
+}
+
+// Data ready consumed by alert() is not lost for get()
+static void testLatchedDataReady()
+{
+    Sensor_TMP116 sensor;
+    mockReset();
+    mockDevice(ADDRESS, true);
+    mockOnRead(onRead);
+
+    restart(125, 1000);
+    sensor.begin(TMP116_EIGHT_SAMPLES, TMP116_CONVERSION_1_SECOND);
+    TEST_CHECK(sensor.get() == TMP116_STALE);
+
+    delay(1000);
+    TEST_CHECK(sensor.alert() == 0);
+    TEST_CHECK(sensor.get() == TMP116_FRESH);
+    TEST_NEAR(sensor.temperature(), 25.0 + 1.0 / 128.0 + 273.15, 0.001);
+    TEST_CHECK(sensor.get() == TMP116_STALE);
+
+    delay(1000);
+    TEST_CHECK(sensor.get() == TMP116_FRESH);
+    TEST_CHECK(sensor.get() == TMP116_STALE);
+}
+
+int main()
+{
+    testFirstWait();
+    testLatchedDataReady();
+    return testResult("test_tmp116");
+}
@@ -0,0 +1,104 @@
+//
+// test_units.cpp
+// Batch conversion and formatting of Sensor_Units
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+
+#include "Test.h"
+#include "Sensor_Units.h"
+
+static void testFixedPoint()
+{
+    // Small gain, 8 fractional bits
+    int32_t input[3] = { 101325 * 256, 300 * 256, -40 * 256 };
+    int32_t output[3];
+    conversion(input, output, 3, transformation(PASCAL, PSI), 8);
+    TEST_NEAR(output[0] / 256.0, 101325.0 * PSI.gain / PASCAL.gain, 1.0 / 256.0);
+
+    conversion(input + 1, output + 1, 2, transformation(KELVIN, FAHRENHEIT), 8);
+    TEST_NEAR(output[1] / 256.0, 300.0 * 1.8 - 459.67, 1.0 / 256.0);
+    TEST_NEAR(output[2] / 256.0, -40.0 * 1.8 - 459.67, 1.0 / 256.0);
+
+    // |gain| >= 2^29, no longer halved
+    unit_transform_s large;
+    large.gain = 1073741824.0f; // 2^30
+    large.base = 3.0f;
+    int32_t small[2] = { 1, -1 };
+    conversion(small, output, 2, large);
+    TEST_CHECK(output[0] == 1073741827);
+    TEST_CHECK(output[1] == -1073741821);
+}
+
+// Results out of range saturate, with the integer and the double paths alike
+static void testSaturation()
+{
+    int32_t input[4] = { INT32_MAX, INT32_MIN, INT32_MAX - 1, 4 };
+    int32_t output[4];
+
+    unit_transform_s unity;
+    unity.gain = 1.0f;
+    unity.base = 1.0f;
+    conversion(input, output, 3, unity);
+    TEST_CHECK(output[0] == INT32_MAX);
+    TEST_CHECK(output[1] == INT32_MIN + 1);
+    TEST_CHECK(output[2] == INT32_MAX);
+
+    unit_transform_s small;
+    small.gain = -1000.0f;
+    small.base = 0.0f;
+    conversion(input, output, 4, small);
+    TEST_CHECK(output[0] == INT32_MIN);
+    TEST_CHECK(output[1] == INT32_MAX);
+    TEST_CHECK(output[3] == -4000);
+
+    unit_transform_s large;
+    large.gain = 1073741824.0f; // 2^30, double path
+    large.base = 0.0f;
+    conversion(input, output, 4, large);
+    TEST_CHECK(output[0] == INT32_MAX);
+    TEST_CHECK(output[1] == INT32_MIN);
+    TEST_CHECK(output[3] == INT32_MAX);
+}
+
+static bool formatted(float value, const unit_conversion_s & unit, uint8_t decimals, const char * expected)
+{
+    char buffer[48];
+    formatUnit(buffer, sizeof(buffer), value, unit, decimals);
+    if (strcmp(buffer, expected) != 0)
+    {
+        printf("formatUnit(%g, %u) = \"%s\", expected \"%s\"\n", value, decimals, buffer, expected);
+        return false;
+    }
+    return true;
+}
+
+static void testFormat()
+{
+    TEST_CHECK(formatted(101325.0, PASCAL, 6, "101325.000000Pa"));
+    TEST_CHECK(formatted(83865.0, LUX, 6, "83865.000000lx"));
+    TEST_CHECK(formatted(5000000000.0, PASCAL, 2, "5000000000.00Pa"));
+    TEST_CHECK(formatted(21.25, PASCAL, 1, "21.3Pa"));
+    TEST_CHECK(formatted(1.999, PASCAL, 2, "2.00Pa"));
+    TEST_CHECK(formatted(-3.5, PASCAL, 1, "-3.5Pa"));
+    TEST_CHECK(formatted(-0.001, PASCAL, 2, "0.00Pa"));
+    TEST_CHECK(formatted(0.05, PASCAL, 2, "0.05Pa"));
+    TEST_CHECK(formatted(7.0, PASCAL, 0, "7Pa"));
+    TEST_CHECK(formatted(INFINITY, PASCAL, 2, "infPa"));
+    TEST_CHECK(formatted(-INFINITY, PASCAL, 2, "-infPa"));
+}
+
+int main()
+{
+    testFixedPoint();
+    testSaturation();
+    testFormat();
+    return testResult("test_units");
+}
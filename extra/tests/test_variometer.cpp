@@ -0,0 +1,94 @@
+//
+// test_variometer.cpp
+// Variometer driven by synthetic climb and descent profiles
+// ----------------------------------
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// 50 Hz pressure samples with 0.03 hPa of uniform noise, about 0.25 m:
+// 10 s level, 20 s climb at 2 m/s, 20 s descent at 3 m/s, 10 s level.
+//
+
+#include "Test.h"
+#include "Sensor_Variometer.h"
+
+#define SAMPLE_PERIOD 20000 // us, 50 Hz
+
+// Deterministic noise, -0.5..0.5
+static uint32_t seed = 1;
+static double noise()
+{
+    seed = seed * 1664525 + 1013904223;
+    return (double)(seed >> 8) / 16777216.0 - 0.5;
+}
+
+static double pressureAt(double altitude)
+{
+    return 1013.25 * pow(1.0 - altitude / BAROMETRIC_ALTITUDE, 1.0 / BAROMETRIC_EXPONENT);
+}
+
+// Speed of the profile at sample index, in m/s
+static double speedAt(uint32_t index)
+{
+    if (index < 500)
+    {
+        return 0.0;
+    }
+    if (index < 1500)
+    {
+        return 2.0;
+    }
+    if (index < 2500)
+    {
+        return -3.0;
+    }
+    return 0.0;
+}
+
+// Runs the profile, checks the estimates 5 s after each change of speed
+static void runProfile(uint32_t timeMicros, double noiseAmplitude, double speedTolerance, double altitudeTolerance)
+{
+    Barometric_Variometer variometer;
+    double altitude = 100.0;
+    double speedError = 0;
+    double altitudeError = 0;
+
+    seed = 1;
+    for (uint32_t index = 0; index < 3000; index++)
+    {
+        altitude += speedAt(index) * SAMPLE_PERIOD * 1e-6;
+        variometer.update(pressureAt(altitude) + noise() * 2.0 * noiseAmplitude, timeMicros);
+        timeMicros += SAMPLE_PERIOD;
+
+        // Settled, 5 s after the start of each segment
+        if ((index % 500) >= 250 and (index >= 250) and (speedAt(index) == speedAt(index - 250)))
+        {
+            speedError = fmax(speedError, fabs(variometer.verticalSpeed() - speedAt(index)));
+            altitudeError = fmax(altitudeError, fabs(variometer.altitude() - altitude));
+        }
+    }
+
+    printf("noise %.2f hPa: speed error %.3f m/s, altitude error %.3f m\n", noiseAmplitude, speedError, altitudeError);
+    TEST_CHECK(speedError < speedTolerance);
+    TEST_CHECK(altitudeError < altitudeTolerance);
+}
+
+int main()
+{
+    // Noise-free, the filter tracks a constant speed without lag
+    runProfile(0, 0.0, 0.01, 0.01);
+
+    // Noisy samples
+    runProfile(0, 0.03, 0.5, 0.5);
+
+    // micros() roll-over in the middle of the climb
+    runProfile(0xffffffff - 20 * 1000000, 0.03, 0.5, 0.5);
+
+    return testResult("test_variometer");
+}
@@ -25,10 +25,19 @@
 #define BME280_CONTROL_TEMPERATURE_PRESSURE 0xf4
 #define BME280_CONTROL_HUMIDITY 0xf2
 #define BME280_STATUS 0xf3
+#define BME280_STATUS_MEASURING 0x08
+#define BME280_STATUS_UPDATE 0x01
 #define BME280_CONFIGURATION 0xf5
 #define BME280_RESET 0xe0
 
 #define BME280_VALUE_RESET_EXECUTE 0xb6
+#define BME280_CHIP_ID 0xd0
+#define BME280_CHIP_ID_VALUE 0x60
+
+// Oversampling x1 for temperature and pressure, forced mode
+#define BME280_MEASURE_SETTINGS 0x25
+// Oversampling x1 for humidity
+#define BME280_HUMIDITY_SETTINGS 0x01
 
 #define BME280_CALIBRATION_T1 0x88
 #define BME280_CALIBRATION_T2 0x8a
@@ -59,27 +68,87 @@
 Sensor_BME280::Sensor_BME280(uint8_t address)
 {
     _slaveAddressBME280 = address;
+    _calibrationTemperature = NULL;
+    _calibrationPressure = NULL;
+    _calibrationHumidity = NULL;
+    _rawTemperature = 0;
+    _rawPressure = 0;
+    _rawHumidity = 0;
+    _triggered = false;
+    _chrono = 0;
 }
 
+#if (SENSOR_HEAP_FREE == 1)
+const char * Sensor_BME280::WhoAmI()
+#else
 String Sensor_BME280::WhoAmI()
+#endif
 {
     return "BME280 temperature + humidity + pressure";
 }
 
+sensor_device_e Sensor_BME280::deviceType()
+{
+    return SENSOR_DEVICE_BME280;
+}
+
 void Sensor_BME280::begin()
+{
+    delay(beginReset());
+    delay(beginConfigure());
+    get();
+}
+
+uint32_t Sensor_BME280::beginReset()
 {
     writeRegister8(_slaveAddressBME280, BME280_RESET, BME280_VALUE_RESET_EXECUTE);
-    delay(100);
-    writeRegister8(_slaveAddressBME280, BME280_CONTROL_TEMPERATURE_PRESSURE, 0x25);
+
+    // Start-up time, 2 ms
+    return 2;
+}
+
+uint32_t Sensor_BME280::beginConfigure()
+{
+    // Humidity control is only applied after a write to the temperature and pressure control
+    writeRegister8(_slaveAddressBME280, BME280_CONTROL_HUMIDITY, BME280_HUMIDITY_SETTINGS);
+    /// xxxxx.011 Default = 0x00
+    /// _____.001 Humidity oversampling x1
+
+    writeRegister8(_slaveAddressBME280, BME280_CONTROL_TEMPERATURE_PRESSURE, BME280_MEASURE_SETTINGS);
     // 001.001.01 Default = 0x00
     // 001.___.__ Pressure oversampling x1
     // ___.001.__ Temperature oversampling x1
     // ___.___.01 Mode = forced mode
+    _triggered = true;
 
-    writeRegister8(_slaveAddressBME280, BME280_CONTROL_HUMIDITY, 0x01);
-    /// xxxxx.011 Default = 0x00
-    /// _____.001 Humidity oversampling x1
+    readCalibration();
+
+    // First forced conversion, µs to ms rounded up
+    return (conversionTime() + 999) / 1000;
+}
 
+bool Sensor_BME280::beginResume()
+{
+    uint8_t control[3]; // humidity control, status, temperature and pressure control
+    readRegisters(_slaveAddressBME280, BME280_CONTROL_HUMIDITY, control, 3);
+
+    // Mode is back to sleep after a forced conversion
+    if ((readRegister8(_slaveAddressBME280, BME280_CHIP_ID) == BME280_CHIP_ID_VALUE) and
+            (control[0] == BME280_HUMIDITY_SETTINGS) and
+            ((control[2] & 0b11111100) == (BME280_MEASURE_SETTINGS & 0b11111100)))
+    {
+        // Calibration is kept by the sensor, not by the MCU
+        readCalibration();
+        get();
+        return true;
+    }
+
+    begin();
+    return false;
+}
+
+void Sensor_BME280::readCalibration()
+{
     //    Register Address	Register content	Data type
     //    ￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼0x88 / 0x89		dig_T1 [7:0] / [15:8]	unsigned short = uint16_t
     //    ￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼0x8A / 0x8B		dig_T2 [7:0] / [15:8]	signed short = int16_t
@@ -147,24 +216,90 @@ void Sensor_BME280::begin()
         QuickDebugln("calibration H5 i16:  %i", _calibrationH5);
         QuickDebugln("calibration H6 i8:   %i", _calibrationH6);
     */
+}
 
-    // Is some delay needed for readiness?
-    delay(100);
-    // First dummy reading required?
-    get();
+void Sensor_BME280::setCalibration(Calibration_Table * temperature, Calibration_Table * pressure, Calibration_Table * humidity)
+{
+    _calibrationTemperature = temperature;
+    _calibrationPressure = pressure;
+    _calibrationHumidity = humidity;
+}
+
+// Oversampling code to number of samples, 0 = skipped
+static uint32_t oversampling(uint8_t code)
+{
+    return (code == 0) ? 0 : ((code > 5) ? 16 : (1 << (code - 1)));
+}
+
+uint32_t Sensor_BME280::conversionTime()
+{
+    // Section 9.1, maximum measurement time in µs
+    uint32_t temperatureSamples = oversampling((BME280_MEASURE_SETTINGS >> 5) & 0x07);
+    uint32_t pressureSamples = oversampling((BME280_MEASURE_SETTINGS >> 2) & 0x07);
+    uint32_t humiditySamples = oversampling(BME280_HUMIDITY_SETTINGS & 0x07);
+
+    uint32_t result = 1250 + 2300 * temperatureSamples;
+    if (pressureSamples > 0)
+    {
+        result += 2300 * pressureSamples + 575;
+    }
+    if (humiditySamples > 0)
+    {
+        result += 2300 * humiditySamples + 575;
+    }
+    return result;
 }
 
+// Table 27, standby time in normal mode in µs
+static const uint32_t standbyTime[8] = { 500, 62500, 125000, 250000, 500000, 1000000, 10000, 20000 };
+
 uint8_t Sensor_BME280::get()
 {
-    // Power-up
-    setPowerMode(HIGH);
+    triggerMeasurement();
+
+    // Forced conversion, in µs
+    uint32_t period = conversionTime();
+    uint32_t chrono = micros();
+    while (micros() - chrono < period);
 
-    int32_t _rawPressure, _rawTemperature, _rawHumidity;
+    return readMeasurement();
+}
+
+void Sensor_BME280::triggerMeasurement()
+{
+    // Forced mode, one conversion then back to sleep
+    writeRegister8(_slaveAddressBME280, BME280_CONTROL_TEMPERATURE_PRESSURE, (BME280_MEASURE_SETTINGS & 0b11111100) | 0b00000001);
+    _triggered = true;
+}
+
+uint8_t Sensor_BME280::readMeasurement()
+{
+    int32_t adcPressure, adcTemperature, adcHumidity;
     int64_t t_fine;
-    _rawPressure = 0;
-    _rawTemperature = 0;
-    _rawHumidity = 0;
-    //    while (readRegister8(_slaveAddressBME280, BME280_STATUS) & 0x08);
+
+    // 0xf3 status, 0xf4 control, 0xf5 configuration
+    uint8_t status[3];
+    readRegisters(_slaveAddressBME280, BME280_STATUS, status, 3);
+
+    // Conversion running or NVM copy, the result registers hold the previous conversion
+    if (status[0] & (BME280_STATUS_MEASURING | BME280_STATUS_UPDATE))
+    {
+        return BME280_STALE;
+    }
+
+    if (not _triggered)
+    {
+        // Sleep or forced mode, no conversion since the last read
+        if ((status[1] & 0b00000011) != 0b00000011)
+        {
+            return BME280_STALE;
+        }
+        // Normal mode, one conversion per measurement period
+        if (micros() - _chrono < conversionTime() + standbyTime[status[2] >> 5])
+        {
+            return BME280_STALE;
+        }
+    }
 
     Wire.beginTransmission(_slaveAddressBME280);
     Wire.write(BME280_DATA_F7_FE);
@@ -177,17 +312,17 @@ uint8_t Sensor_BME280::get()
     //        data[i] = Wire.read();
     //    }
     //
-    //    _rawPressure = ((uint32_t)data[0] << 12) + ((uint32_t)data[1] << 4) + ((uint32_t)data[2]>> 4); // f7.f8.f9
-    //    _rawTemperature = ((uint32_t)data[3] << 12) + ((uint32_t)data[4] << 4) + ((uint32_t)data[5]>> 4); // fa.fb.fc
-    //    _rawHumidity = ((uint32_t)data[6] << 8) + ((uint32_t)data[7]); // fd.fe
+    //    adcPressure = ((uint32_t)data[0] << 12) + ((uint32_t)data[1] << 4) + ((uint32_t)data[2]>> 4); // f7.f8.f9
+    //    adcTemperature = ((uint32_t)data[3] << 12) + ((uint32_t)data[4] << 4) + ((uint32_t)data[5]>> 4); // fa.fb.fc
+    //    adcHumidity = ((uint32_t)data[6] << 8) + ((uint32_t)data[7]); // fd.fe
 
     Wire.requestFrom(_slaveAddressBME280, 8);
     while (Wire.available() < 8);
-    _rawPressure = ((uint32_t)Wire.read() << 12) + ((uint32_t)Wire.read() << 4) + ((uint32_t)Wire.read() >> 4); // f7.f8.f9
-    _rawTemperature = ((uint32_t)Wire.read() << 12) + ((uint32_t)Wire.read() << 4) + ((uint32_t)Wire.read() >> 4); // fa.fb.fc
-    _rawHumidity = ((uint32_t)Wire.read() << 8) + ((uint32_t)Wire.read()); // fd.fe
+    adcPressure = ((uint32_t)Wire.read() << 12) + ((uint32_t)Wire.read() << 4) + ((uint32_t)Wire.read() >> 4); // f7.f8.f9
+    adcTemperature = ((uint32_t)Wire.read() << 12) + ((uint32_t)Wire.read() << 4) + ((uint32_t)Wire.read() >> 4); // fa.fb.fc
+    adcHumidity = ((uint32_t)Wire.read() << 8) + ((uint32_t)Wire.read()); // fd.fe
 
-    if (_rawPressure == 0x80000)
+    if (adcPressure == 0x80000)
     {
         return BME280_ERROR;
         //        Serial.print("!!! Error");
@@ -296,12 +431,18 @@ uint8_t Sensor_BME280::get()
     int64_t var1, var2, var3;
 
     // 1. Temperature
-    var1  = ((((_rawTemperature >> 3) - ((int32_t)_calibrationT1 << 1))) * ((int32_t)_calibrationT2)) >> 11;
-    var2  = (((((_rawTemperature >> 4) - ((int32_t)_calibrationT1)) * ((_rawTemperature >> 4) - ((int32_t)_calibrationT1))) >> 12) * ((int32_t)_calibrationT3)) >> 14;
+    var1  = ((((adcTemperature >> 3) - ((int32_t)_calibrationT1 << 1))) * ((int32_t)_calibrationT2)) >> 11;
+    var2  = (((((adcTemperature >> 4) - ((int32_t)_calibrationT1)) * ((adcTemperature >> 4) - ((int32_t)_calibrationT1))) >> 12) * ((int32_t)_calibrationT3)) >> 14;
     t_fine = var1 + var2;
 
     // _temperature  = (float)(t_fine * 5 + 128) / 25600.0;
-    _temperature = (float)(t_fine) / 5120.0 + 273.15; // in Kelvin
+    var3 = t_fine;
+    if (_calibrationTemperature != NULL)
+    {
+        var3 = _calibrationTemperature->apply((int32_t)var3);
+    }
+    _rawTemperature = (int32_t)var3;
+    _temperature = (float)(var3) / 5120.0 + 273.15; // in Kelvin
 
     // 2. Pressure
     var1 = ((int64_t)t_fine) - 128000;
@@ -313,19 +454,24 @@ uint8_t Sensor_BME280::get()
 
     if (var1 != 0)
     {
-        var3 = 1048576 - _rawPressure;
+        var3 = 1048576 - adcPressure;
         var3 = (((var3 << 31) - var2) * 3125) / var1;
         var1 = (((int64_t)_calibrationP9) * (var3 >> 13) * (var3 >> 13)) >> 25;
         var2 = (((int64_t)_calibrationP8) * var3) >> 19;
 
         var3 = ((var3 + var1 + var2) >> 8) + (((int64_t)_calibrationP7) << 4);
+        if (_calibrationPressure != NULL)
+        {
+            var3 = _calibrationPressure->apply((int32_t)var3);
+        }
+        _rawPressure = (int32_t)var3;
         _pressure = (float)var3 / 25600.0; // in hPa
     }
 
     // 3. Humidity
     var1 = (t_fine - ((int32_t)76800));
 
-    var1 = (((((_rawHumidity << 14) - (((int32_t)_calibrationH4) << 20) - (((int32_t)_calibrationH5) * var1)) + ((int32_t)16384)) >> 15) * (((((((var1 * ((int32_t)_calibrationH6)) >> 10) * (((var1 * ((int32_t)_calibrationH3)) >> 11) + ((int32_t)32768))) >> 10) + ((int32_t)2097152)) * ((int32_t)_calibrationH2) + 8192) >> 14));
+    var1 = (((((adcHumidity << 14) - (((int32_t)_calibrationH4) << 20) - (((int32_t)_calibrationH5) * var1)) + ((int32_t)16384)) >> 15) * (((((((var1 * ((int32_t)_calibrationH6)) >> 10) * (((var1 * ((int32_t)_calibrationH3)) >> 11) + ((int32_t)32768))) >> 10) + ((int32_t)2097152)) * ((int32_t)_calibrationH2) + 8192) >> 14));
 
     var1 = (var1 - (((((var1 >> 15) * (var1 >> 15)) >> 7) * ((int32_t)_calibrationH1)) >> 4));
 
@@ -337,8 +483,17 @@ uint8_t Sensor_BME280::get()
     {
         var1 = 419430400;
     }
-    _humidity = (float)(var1 >> 12) / 1024.0; // in %
+    var1 = var1 >> 12;
+    if (_calibrationHumidity != NULL)
+    {
+        var1 = _calibrationHumidity->apply((int32_t)var1);
+        var1 = (var1 < 0) ? 0 : ((var1 > 102400) ? 102400 : var1);
+    }
+    _rawHumidity = (int32_t)var1;
+    _humidity = (float)(var1) / 1024.0; // in %
 
+    _triggered = false;
+    _chrono = micros();
     return BME280_SUCCESS;
 }
 
@@ -358,6 +513,21 @@ float Sensor_BME280::pressure()
     return _pressure;
 }
 
+int32_t Sensor_BME280::rawTemperature()
+{
+    return _rawTemperature;
+}
+
+int32_t Sensor_BME280::rawPressure()
+{
+    return _rawPressure;
+}
+
+int32_t Sensor_BME280::rawHumidity()
+{
+    return _rawHumidity;
+}
+
 void Sensor_BME280::setPowerMode(uint8_t mode)
 {
     uint8_t configuration = readRegister8(_slaveAddressBME280, BME280_CONTROL_TEMPERATURE_PRESSURE);
@@ -366,29 +536,24 @@ void Sensor_BME280::setPowerMode(uint8_t mode)
     configuration |= mode;
 
     writeRegister8(_slaveAddressBME280, BME280_CONTROL_TEMPERATURE_PRESSURE, configuration);
+    _triggered = ((mode & 0b00000011) != 0b00000000);
 }
 
 float Sensor_BME280::absolutePressure(float altitudeMeters)
 {
-    return _pressure / pow(1 - altitudeMeters / 44330.77, 5.255876);
-
-    // Absolute pressure from read = relative pressure would be
-    // return seaLevelPressure * pow(1 - altitudeMeters / 44330.77, 5.255876);
+    return _barometric.seaLevelPressure(_pressure, altitudeMeters);
 }
 
 float Sensor_BME280::altitude(float seaLevelPressure)
 {
-    return 44330.77 * (1.0 - pow(_pressure / seaLevelPressure, 0.190263));
+    _barometric.setSeaLevel(seaLevelPressure);
+    return _barometric.altitude(_pressure);
 }
 
 float Sensor_BME280::altitude(float referencePressure, float referenceAltitude)
 {
-    // Sea level pressure
-    float seaLevelPressure = referencePressure / pow(1 - referenceAltitude  / 44330.77, 5.255876);
+    // Sea level pressure, cached
+    _barometric.setReference(referencePressure, referenceAltitude);
     // Altitude based on absolute pressure
-    return 44330.0 * (1.0 - pow(_pressure / seaLevelPressure, 0.190263));
+    return _barometric.altitude(_pressure);
 }
-
-
-
-
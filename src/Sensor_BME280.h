@@ -61,8 +61,12 @@
 
 #define BME280_SUCCESS   0   ///< success
 #define BME280_ERROR     1   ///< error
+#define BME280_STALE     2   ///< no new conversion since the last read
 
 #include "Wire.h"
+#include "Sensor_Device.h"
+#include "Sensor_Calibration.h"
+#include "Sensor_Barometric.h"
 
 ///
 /// @brief    Default BME280 I2C address
@@ -100,15 +104,47 @@ class Sensor_BME280
     ///
     void begin();
 
+    ///
+    /// @brief	Initialisation, first step: reset
+    /// @return	period to wait before beginConfigure(), ms
+    /// @note   For parallel initialisation with Sensor_Startup. begin() performs both steps.
+    ///
+    uint32_t beginReset();
+
+    ///
+    /// @brief	Initialisation, second step: configuration, calibration and first conversion
+    /// @return	period to wait before the first get(), ms
+    ///
+    uint32_t beginConfigure();
+
+    ///
+    /// @brief	Initialisation, warm resume
+    /// @return	true if resumed without reset, false if begin() was performed
+    /// @note   Chip identity and control registers are read back and compared
+    /// @n      with the configuration set by begin(). The reset is skipped on match.
+    ///
+    bool beginResume();
+
     ///
     ///	@brief  Who am I?
     ///	@return Who am I? string
     ///
+#if (SENSOR_HEAP_FREE == 1)
+    const char * WhoAmI();
+#else
     String WhoAmI();
+#endif
+
+    ///
+    /// @brief	Device type
+    /// @return	device identifier, SENSOR_DEVICE_BME280
+    ///
+    sensor_device_e deviceType();
 
     ///
     ///	@brief	Acquire data
     /// @return 0 if success, error code otherwise
+    /// @note   Performs triggerMeasurement(), waits for conversionTime() and performs readMeasurement().
     /// @code
     ///    do
     ///    {
@@ -121,6 +157,30 @@ class Sensor_BME280
     ///
     uint8_t get();
 
+    ///
+    ///	@brief	Start a forced conversion, without waiting
+    /// @note   The BME280 goes back to sleep after the conversion.
+    ///
+    void triggerMeasurement();
+
+    ///
+    ///	@brief	Read the last conversion if it is new, without waiting
+    /// @return BME280_SUCCESS, BME280_STALE if no conversion completed since the last read, BME280_ERROR
+    /// @note   Call conversionTime() after triggerMeasurement().
+    /// @n      BME280_STALE while the status register reports a conversion or an NVM copy,
+    ///         or without triggerMeasurement() since the last read.
+    ///
+    uint8_t readMeasurement();
+
+    ///
+    /// @brief	Attach software calibrations
+    /// @param	temperature calibration table for temperature, in 1/5120 °C, NULL = none
+    /// @param	pressure calibration table for pressure, in 1/256 Pa, NULL = none
+    /// @param	humidity calibration table for humidity, in 1/1024 %, NULL = none
+    /// @note   Temperature calibration does not change the compensation of pressure and humidity.
+    ///
+    void setCalibration(Calibration_Table * temperature, Calibration_Table * pressure = NULL, Calibration_Table * humidity = NULL);
+
     ///
     /// @brief	Return temperature
     /// @return temperature, in °K
@@ -141,6 +201,34 @@ class Sensor_BME280
     ///
     float pressure();
 
+    ///
+    /// @brief	Return raw temperature
+    /// @return temperature from the compensation formula and calibration, 1 LSB = 1/5120 °C
+    ///
+    int32_t rawTemperature();
+
+    ///
+    /// @brief	Return raw pressure
+    /// @return pressure from the compensation formula and calibration, 1 LSB = 1/256 Pa
+    /// @note   101325 Pa is 25.9 M LSB, beyond the 24-bit mantissa of pressure().
+    ///
+    int32_t rawPressure();
+
+    ///
+    /// @brief	Return raw humidity
+    /// @return humidity from the compensation formula and calibration, 1 LSB = 1/1024 %
+    ///
+    int32_t rawHumidity();
+
+    ///
+    /// @brief	Conversion time
+    /// @return	maximum duration of one forced conversion, in µs
+    /// @note   Computed from the oversampling with the formula of the data-sheet,
+    ///         1.25 ms + 2.3 ms per temperature sample + 2.3 ms per pressure sample + 0.575 ms
+    ///         + 2.3 ms per humidity sample + 0.575 ms.
+    ///
+    uint32_t conversionTime();
+
     ///
     /// @brief	Return absolute pressure, equivalent at sea level
     /// @param  altitudeMeters current altitude, in meter
@@ -154,6 +242,7 @@ class Sensor_BME280
     /// @param  seaLevelPressure pressure at sea level, in hPa
     /// @return altitude, in meter
     /// @note   Use conversion() for another unit
+    /// @see    Barometric_Formula for the error bound
     ///
     float altitude(float seaLevelPressure = 1013.250);
 
@@ -163,9 +252,10 @@ class Sensor_BME280
     /// @param  referenceAltitude reference altitude, in meter
     /// @return altitude in meter
     /// @note   The reference is a measure of the pressure at a known altitude.
+    /// @note   The sea level pressure is only recomputed when the reference changes.
     /// @note   Use conversion() for another unit
     ///
-    float altitude(float referencePressure = 1013.250, float referenceAltitude = 0.0);
+    float altitude(float referencePressure, float referenceAltitude);
 
     ///
     /// @brief	Set power mode
@@ -174,9 +264,20 @@ class Sensor_BME280
     void setPowerMode(uint8_t mode = LOW);
 
   private:
+    void readCalibration();
+
+    Barometric_Formula _barometric;
+    Calibration_Table * _calibrationTemperature;
+    Calibration_Table * _calibrationPressure;
+    Calibration_Table * _calibrationHumidity;
     float _temperature;
     float _humidity;
     float _pressure;
+    int32_t _rawTemperature;
+    int32_t _rawPressure;
+    int32_t _rawHumidity;
+    bool _triggered; ///< conversion started since the last read
+    uint32_t _chrono; ///< µs, last read, for normal mode
 
     uint16_t _calibrationT1;
     int16_t  _calibrationT2;
@@ -23,10 +23,17 @@
 #define BMP280_DATA_F7_FC       0xf7
 #define BMP280_CONTROL          0xf4
 #define BMP280_STATUS           0xf3
+#define BMP280_STATUS_MEASURING 0x08
+#define BMP280_STATUS_UPDATE    0x01
 #define BMP280_CONFIGURATION    0xf5
 #define BMP280_RESET            0xe0
 
 #define BMP280_VALUE_RESET_EXECUTE  0xb6
+#define BMP280_CHIP_ID          0xd0
+#define BMP280_CHIP_ID_VALUE    0x58
+
+// Oversampling x1 for temperature and pressure, normal mode
+#define BMP280_MEASURE_SETTINGS 0x27
 
 #define BMP280_CALIBRATION_T1   0x88
 #define BMP280_CALIBRATION_T2   0x8a
@@ -52,24 +59,81 @@
 Sensor_BMP280::Sensor_BMP280(uint8_t address)
 {
     _address = address;
+    _rawTemperature = 0;
+    _rawPressure = 0;
+    _triggered = false;
+    _chrono = 0;
 }
 
+#if (SENSOR_HEAP_FREE == 1)
+const char * Sensor_BMP280::WhoAmI()
+#else
 String Sensor_BMP280::WhoAmI()
+#endif
 {
     return "BMP280 temperature + pressure";
 }
 
+sensor_device_e Sensor_BMP280::deviceType()
+{
+    return SENSOR_DEVICE_BMP280;
+}
+
 void Sensor_BMP280::begin()
+{
+    delayBusy(beginReset());
+    delayBusy(beginConfigure());
+    get();
+}
+
+uint32_t Sensor_BMP280::beginReset()
 {
     // BMP280 uses a different I2C port
     //    pinMode(Board_MPU_POWER, OUTPUT);
     writeRegister8(_address, BMP280_RESET, BMP280_VALUE_RESET_EXECUTE);
-    delayBusy(100); //    delay(100);
+
+    // Start-up time, 2 ms
+    return 2;
+}
+
+uint32_t Sensor_BMP280::beginConfigure()
+{
     //          7  4   0
     // 0x27 = 0b00100111
     //
-    writeRegister8(_address, BMP280_CONTROL, 0b00100111);
+    writeRegister8(_address, BMP280_CONTROL, BMP280_MEASURE_SETTINGS);
+    _triggered = true;
+
+    readCalibration();
+
+    // First conversion in normal mode, µs to ms rounded up
+    return (conversionTime() + 999) / 1000;
+}
 
+bool Sensor_BMP280::beginResume()
+{
+    // Mode may have been set to sleep by setPowerMode()
+    if ((readRegister8(_address, BMP280_CHIP_ID) == BMP280_CHIP_ID_VALUE) and
+            ((readRegister8(_address, BMP280_CONTROL) & 0b11111100) == (BMP280_MEASURE_SETTINGS & 0b11111100)))
+    {
+        // Calibration is kept by the sensor, not by the MCU
+        readCalibration();
+
+        if (readRegister8(_address, BMP280_CONTROL) != BMP280_MEASURE_SETTINGS)
+        {
+            writeRegister8(_address, BMP280_CONTROL, BMP280_MEASURE_SETTINGS);
+            delayBusy((conversionTime() + 999) / 1000);
+        }
+        get();
+        return true;
+    }
+
+    begin();
+    return false;
+}
+
+void Sensor_BMP280::readCalibration()
+{
     //    Register Address	Register content	Data type
     //    ￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼0x88 / 0x89		dig_T1 [7:0] / [15:8]	unsigned short = uint16_t
     //    ￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼￼0x8A / 0x8B		dig_T2 [7:0] / [15:8]	signed short = int16_t
@@ -97,18 +161,75 @@ void Sensor_BMP280::begin()
     _calibrationP7 = readRegister16(_address, BMP280_CALIBRATION_P7, LSBFIRST); // int16_t
     _calibrationP8 = readRegister16(_address, BMP280_CALIBRATION_P8, LSBFIRST); // int16_t
     _calibrationP9 = readRegister16(_address, BMP280_CALIBRATION_P9, LSBFIRST); // int16_t
+}
 
-    // Is some delay needed for readiness?
-    //    delay(100);
-    delayBusy(100);
-    // First dummy reading required?
-    get();
+// Oversampling code to number of samples, 0 = skipped
+static uint32_t oversampling(uint8_t code)
+{
+    return (code == 0) ? 0 : ((code > 5) ? 16 : (1 << (code - 1)));
+}
+
+// Table 11, standby time in normal mode in µs
+static const uint32_t standbyTime[8] = { 500, 62500, 125000, 250000, 500000, 1000000, 2000000, 4000000 };
 
+uint32_t Sensor_BMP280::conversionTime()
+{
+    // Appendix B, maximum measurement time in µs
+    uint32_t temperatureSamples = oversampling((BMP280_MEASURE_SETTINGS >> 5) & 0x07);
+    uint32_t pressureSamples = oversampling((BMP280_MEASURE_SETTINGS >> 2) & 0x07);
+
+    uint32_t result = 1250 + 2300 * temperatureSamples;
+    if (pressureSamples > 0)
+    {
+        result += 2300 * pressureSamples + 575;
+    }
+    return result;
+}
+
+void Sensor_BMP280::triggerMeasurement()
+{
+    // Normal mode converts on its own, sleep and forced modes convert once per forced write
+    uint8_t configuration = readRegister8(_address, BMP280_CONTROL);
+
+    if ((configuration & 0b00000011) != 0b00000011)
+    {
+        writeRegister8(_address, BMP280_CONTROL, (configuration & 0b11111100) | 0b00000001);
+        _triggered = true;
+    }
+}
+
+uint8_t Sensor_BMP280::readMeasurement()
+{
+    // 0xf3 status, 0xf4 control, 0xf5 configuration
+    uint8_t data[3];
+    readRegisters(_address, BMP280_STATUS, data, 3);
+
+    // Conversion running or NVM copy, the result registers hold the previous conversion
+    if (data[0] & (BMP280_STATUS_MEASURING | BMP280_STATUS_UPDATE))
+    {
+        return BMP280_STALE;
+    }
+
+    if (not _triggered)
+    {
+        // Sleep or forced mode, no conversion since the last read
+        if ((data[1] & 0b00000011) != BMP280_NORMAL_MODE)
+        {
+            return BMP280_STALE;
+        }
+        // Normal mode, one conversion per measurement period
+        if (micros() - _chrono < conversionTime() + standbyTime[data[2] >> 5])
+        {
+            return BMP280_STALE;
+        }
+    }
+
+    return get();
 }
 
 uint8_t Sensor_BMP280::get()
 {
-    int32_t _rawPressure, _rawTemperature, _rawHumidity;
+    int32_t adcPressure, adcTemperature;
     int32_t t_fine;
 
     //    while (readRegister8(_address, BMP280_STATUS) & 0x08);
@@ -130,10 +251,10 @@ uint8_t Sensor_BMP280::get()
 
     Wire.requestFrom(_address, 6);
     while (Wire.available() < 6);
-    _rawPressure = ((uint32_t)Wire.read() << 12) + ((uint32_t)Wire.read() << 4) + ((uint32_t)Wire.read() >> 4); // f7.f8.f9
-    _rawTemperature = ((uint32_t)Wire.read() << 12) + ((uint32_t)Wire.read() << 4) + ((uint32_t)Wire.read() >> 4); // fa.fb.fc
+    adcPressure = ((uint32_t)Wire.read() << 12) + ((uint32_t)Wire.read() << 4) + ((uint32_t)Wire.read() >> 4); // f7.f8.f9
+    adcTemperature = ((uint32_t)Wire.read() << 12) + ((uint32_t)Wire.read() << 4) + ((uint32_t)Wire.read() >> 4); // fa.fb.fc
 
-    if (_rawPressure == 0x80000)
+    if (adcPressure == 0x80000)
     {
         return BMP280_ERROR;
     }
@@ -142,11 +263,12 @@ uint8_t Sensor_BMP280::get()
     int64_t var1, var2, var3;
 
     // 1. Temperature
-    var1  = ((((_rawTemperature >> 3) - ((int32_t)_calibrationT1 << 1))) * ((int32_t)_calibrationT2)) >> 11;
-    var2  = (((((_rawTemperature >> 4) - ((int32_t)_calibrationT1)) * ((_rawTemperature >> 4) - ((int32_t)_calibrationT1))) >> 12) * ((int32_t)_calibrationT3)) >> 14;
+    var1  = ((((adcTemperature >> 3) - ((int32_t)_calibrationT1 << 1))) * ((int32_t)_calibrationT2)) >> 11;
+    var2  = (((((adcTemperature >> 4) - ((int32_t)_calibrationT1)) * ((adcTemperature >> 4) - ((int32_t)_calibrationT1))) >> 12) * ((int32_t)_calibrationT3)) >> 14;
     t_fine = var1 + var2;
 
     // _temperature  = (float)(t_fine * 5 + 128) / 25600.0;
+    _rawTemperature = t_fine;
     _temperature = (float)(t_fine) / 5120.0 + 273.15; // in Kelvin
 
     // 2. Pressure
@@ -159,15 +281,18 @@ uint8_t Sensor_BMP280::get()
 
     if (var1 != 0)
     {
-        var3 = 1048576 - _rawPressure;
+        var3 = 1048576 - adcPressure;
         var3 = (((var3 << 31) - var2) * 3125) / var1;
         var1 = (((int64_t)_calibrationP9) * (var3 >> 13) * (var3 >> 13)) >> 25;
         var2 = (((int64_t)_calibrationP8) * var3) >> 19;
 
         var3 = ((var3 + var1 + var2) >> 8) + (((int64_t)_calibrationP7) << 4);
+        _rawPressure = (int32_t)var3;
         _pressure = (float)var3 / 25600.0; // in hPa
     }
 
+    _triggered = false;
+    _chrono = micros();
     return BMP280_SUCCESS;
 }
 
@@ -182,6 +307,16 @@ float Sensor_BMP280::pressure()
     return _pressure;
 }
 
+int32_t Sensor_BMP280::rawTemperature()
+{
+    return _rawTemperature;
+}
+
+int32_t Sensor_BMP280::rawPressure()
+{
+    return _rawPressure;
+}
+
 void Sensor_BMP280::setPowerMode(uint8_t mode)
 {
 //    uint8_t value = readRegister8(_address, BMP280_CONTROL);
@@ -201,29 +336,24 @@ void Sensor_BMP280::setPowerMode(uint8_t mode)
     configuration |= mode;
 
     writeRegister8(_address, BMP280_CONTROL, configuration);
+    _triggered = ((mode & 0b00000011) != BMP280_SLEEP_MODE);
 }
 
 float Sensor_BMP280::absolutePressure(float altitudeMeters)
 {
-    return _pressure / pow(1 - altitudeMeters / 44330.77, 5.255876);
-
-    // Absolute pressure from read = relative pressure would be
-    // return seaLevelPressure * pow(1 - altitudeMeters / 44330.77, 5.255876);
+    return _barometric.seaLevelPressure(_pressure, altitudeMeters);
 }
 
 float Sensor_BMP280::altitude(float seaLevelPressure)
 {
-    return 44330.77 * (1.0 - pow(_pressure / seaLevelPressure, 0.190263));
+    _barometric.setSeaLevel(seaLevelPressure);
+    return _barometric.altitude(_pressure);
 }
 
 float Sensor_BMP280::altitude(float referencePressure, float referenceAltitude)
 {
-    // Sea level pressure
-    float seaLevelPressure = referencePressure / pow(1 - referenceAltitude  / 44330.77, 5.255876);
+    // Sea level pressure, cached
+    _barometric.setReference(referencePressure, referenceAltitude);
     // Altitude based on absolute pressure
-    return 44330.0 * (1.0 - pow(_pressure / seaLevelPressure, 0.1903));
+    return _barometric.altitude(_pressure);
 }
-
-
-
-
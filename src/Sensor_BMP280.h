@@ -66,6 +66,7 @@
 
 #define BMP280_SUCCESS   0   ///< success
 #define BMP280_ERROR     1   ///< error
+#define BMP280_STALE     2   ///< no new conversion since the last read
 
 ///
 /// @brief    BME280 modes
@@ -76,6 +77,8 @@
 /// @}
 
 #include "Wire.h"
+#include "Sensor_Device.h"
+#include "Sensor_Barometric.h"
 
 ///
 /// @brief      Class for sensor BMP280
@@ -102,15 +105,47 @@ class Sensor_BMP280
     ///
     void begin();
 
+    ///
+    /// @brief	Initialisation, first step: reset
+    /// @return	period to wait before beginConfigure(), ms
+    /// @note   For parallel initialisation with Sensor_Startup. begin() performs both steps.
+    ///
+    uint32_t beginReset();
+
+    ///
+    /// @brief	Initialisation, second step: configuration, calibration and first conversion
+    /// @return	period to wait before the first get(), ms
+    ///
+    uint32_t beginConfigure();
+
+    ///
+    /// @brief	Initialisation, warm resume
+    /// @return	true if resumed without reset, false if begin() was performed
+    /// @note   Chip identity and control registers are read back and compared
+    /// @n      with the configuration set by begin(). The reset is skipped on match.
+    ///
+    bool beginResume();
+
     ///
     ///	@brief  Who am I?
     ///	@return Who am I? string
     ///
+#if (SENSOR_HEAP_FREE == 1)
+    const char * WhoAmI();
+#else
     String WhoAmI();
+#endif
+
+    ///
+    /// @brief	Device type
+    /// @return	device identifier, SENSOR_DEVICE_BMP280
+    ///
+    sensor_device_e deviceType();
 
     ///
     ///	@brief	Acquire data
     /// @return 0 if success, error code otherwise
+    /// @note   Only reads the result registers, see triggerMeasurement() and readMeasurement().
     /// @code
     ///    do
     ///    {
@@ -123,6 +158,22 @@ class Sensor_BMP280
     ///
     uint8_t get();
 
+    ///
+    ///	@brief	Start a conversion, without waiting
+    /// @note   In normal mode, set by begin(), does nothing as the BMP280 converts on its own.
+    /// @n      In sleep or forced mode, writes the forced mode to the control register.
+    ///
+    void triggerMeasurement();
+
+    ///
+    ///	@brief	Read the last conversion if it is new, without waiting
+    /// @return BMP280_SUCCESS, BMP280_STALE if no conversion completed since the last read, BMP280_ERROR
+    /// @note   BMP280_STALE while the status register reports a conversion or an NVM copy.
+    /// @n      In sleep or forced mode, a new conversion requires triggerMeasurement().
+    /// @n      In normal mode, a new conversion is available once per conversionTime() plus standby time.
+    ///
+    uint8_t readMeasurement();
+
     ///
     /// @brief	Return temperature
     /// @return temperature, in °K
@@ -137,6 +188,27 @@ class Sensor_BMP280
     ///
     float pressure();
 
+    ///
+    /// @brief	Return raw temperature
+    /// @return temperature from the compensation formula, 1 LSB = 1/5120 °C
+    ///
+    int32_t rawTemperature();
+
+    ///
+    /// @brief	Return raw pressure
+    /// @return pressure from the compensation formula, 1 LSB = 1/256 Pa
+    /// @note   101325 Pa is 25.9 M LSB, beyond the 24-bit mantissa of pressure().
+    ///
+    int32_t rawPressure();
+
+    ///
+    /// @brief	Conversion time
+    /// @return	maximum duration of one conversion, in µs
+    /// @note   Computed from the oversampling with the formula of the data-sheet,
+    ///         1.25 ms + 2.3 ms per temperature sample + 2.3 ms per pressure sample + 0.575 ms.
+    ///
+    uint32_t conversionTime();
+
     ///
     /// @brief	Return absolute pressure, equivalent at sea level
     /// @param  altitudeMeters current altitude, in meter
@@ -150,6 +222,7 @@ class Sensor_BMP280
     /// @param  seaLevelPressure pressure at sea level, in hPa
     /// @return altitude, in meter
     /// @note   Use conversion() for another unit
+    /// @see    Barometric_Formula for the error bound
     ///
     float altitude(float seaLevelPressure = 1013.250);
 
@@ -159,9 +232,10 @@ class Sensor_BMP280
     /// @param  referenceAltitude reference altitude, in meter
     /// @return altitude in meter
     /// @note   The reference is a measure of the pressure at a known altitude.
+    /// @note   The sea level pressure is only recomputed when the reference changes.
     /// @note   Use conversion() for another unit
     ///
-    float altitude(float referencePressure = 1013.250, float referenceAltitude = 0.0);
+    float altitude(float referencePressure, float referenceAltitude);
 
     ///
     /// @brief	Set power mode
@@ -170,9 +244,16 @@ class Sensor_BMP280
     void setPowerMode(uint8_t mode = LOW);
 
   private:
+    void readCalibration();
+
+    Barometric_Formula _barometric;
     uint8_t _address;
     float _temperature;
     float _pressure;
+    int32_t _rawTemperature;
+    int32_t _rawPressure;
+    bool _triggered; ///< conversion started since the last read
+    uint32_t _chrono; ///< µs, last read
 
     uint16_t _calibrationT1;
     int16_t  _calibrationT2;
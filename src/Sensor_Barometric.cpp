@@ -0,0 +1,163 @@
+//
+// Sensor_Barometric.cpp
+// Library C++ code
+// ----------------------------------
+// Developed with embedXcode+
+// https://embedXcode.weebly.com
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// See 			Sensor_Barometric.h and ReadMe.txt for references
+//
+
+
+// Include library header
+#include "Sensor_Barometric.h"
+
+// Table of ratio ^ BAROMETRIC_EXPONENT as Q2.30
+// for ratio = 0.25 + index / 64, index = 0..65
+#define BAROMETRIC_TABLE_SEGMENTS 64
+#define BAROMETRIC_TABLE_START 0.25
+
+static const uint32_t barometricTable[BAROMETRIC_TABLE_SEGMENTS + 2] =
+{
+    824802806, 834371676, 843495096, 852216907, 860574592, 868600468,
+    876322608, 883765559, 890950921, 897897804, 904623204, 911142309,
+    917468745, 923614792, 929591557, 935409119, 941076654, 946602544,
+    951994464, 957259462, 962404028, 967434151, 972355368, 977172812,
+    981891249, 986515117, 991048547, 995495402, 999859290, 1004143594,
+    1008351486, 1012485948, 1016549781, 1020545627, 1024475978, 1028343184,
+    1032149470, 1035896938, 1039587583, 1043223294, 1046805867, 1050337006,
+    1053818334, 1057251392, 1060637654, 1063978519, 1067275327, 1070529355,
+    1073741824, 1076913902, 1080046708, 1083141310, 1086198735, 1089219967,
+    1092205950, 1095157588, 1098075754, 1100961284, 1103814982, 1106637622,
+    1109429950, 1112192685, 1114926518, 1117632115, 1120310122, 1122961158
+};
+
+// Quadratic interpolation on entries index, index + 1 and index + 2
+// ratio is Q2.30, result is Q2.30
+static uint32_t barometricPowerFixed(uint32_t ratio)
+{
+    const uint32_t start = (uint32_t)(BAROMETRIC_TABLE_START * 1073741824.0);
+
+    if (ratio < start)
+    {
+        ratio = start;
+    }
+    uint64_t position = (uint64_t)(ratio - start) * BAROMETRIC_TABLE_SEGMENTS; // Q30
+    uint32_t index = (uint32_t)(position >> 30);
+    if (index > BAROMETRIC_TABLE_SEGMENTS - 1)
+    {
+        index = BAROMETRIC_TABLE_SEGMENTS - 1;
+    }
+    int64_t u = (int64_t)(position >> 14) - ((int64_t)index << 16); // Q16
+    if (u > 0x20000)
+    {
+        u = 0x20000; // beyond 1.25 + 1 / 64
+    }
+
+    int64_t d1 = (int64_t)barometricTable[index + 1] - (int64_t)barometricTable[index];
+    int64_t d2 = (int64_t)barometricTable[index + 2] - 2 * (int64_t)barometricTable[index + 1] + (int64_t)barometricTable[index];
+
+    return (uint32_t)((int64_t)barometricTable[index] + ((u * d1) >> 16) + ((((u * (u - 0x10000)) >> 17) * d2) >> 16));
+}
+
+static float barometricPower(float ratio)
+{
+    float position = (ratio - (float)BAROMETRIC_TABLE_START) * BAROMETRIC_TABLE_SEGMENTS;
+    if (position < 0)
+    {
+        position = 0;
+    }
+    else if (position > BAROMETRIC_TABLE_SEGMENTS + 1)
+    {
+        position = BAROMETRIC_TABLE_SEGMENTS + 1;
+    }
+
+    uint8_t index = (uint8_t)position;
+    if (index > BAROMETRIC_TABLE_SEGMENTS - 1)
+    {
+        index = BAROMETRIC_TABLE_SEGMENTS - 1;
+    }
+    float u = position - (float)index;
+
+    float t0 = (float)barometricTable[index];
+    float d1 = (float)barometricTable[index + 1] - t0;
+    float d2 = (float)barometricTable[index + 2] - 2.0f * (float)barometricTable[index + 1] + t0;
+
+    return (t0 + u * d1 + u * (u - 1.0f) * 0.5f * d2) * (1.0f / 1073741824.0f);
+}
+
+// Code
+Barometric_Formula::Barometric_Formula(float seaLevelPressure)
+{
+    _seaLevelPressure = 0;
+    _referencePressure = 0;
+    _referenceAltitude = 0;
+    _referenceSeaLevel = seaLevelPressure;
+    _altitude = 0;
+    _altitudeFactor = 1.0;
+    setSeaLevel(seaLevelPressure);
+}
+
+void Barometric_Formula::setSeaLevel(float seaLevelPressure)
+{
+    if ((seaLevelPressure == _seaLevelPressure) or (seaLevelPressure <= 0))
+    {
+        return;
+    }
+
+    _seaLevelPressure = seaLevelPressure;
+    _inverseSeaLevel = 1.0 / seaLevelPressure;
+    // 2^54 / (sea level pressure in Pa as Q24.8)
+    _inverseSeaLevelFixed = (uint32_t)(18014398509481984.0 / ((double)seaLevelPressure * 25600.0));
+}
+
+void Barometric_Formula::setReference(float referencePressure, float referenceAltitude)
+{
+    if ((referencePressure != _referencePressure) or (referenceAltitude != _referenceAltitude))
+    {
+        _referencePressure = referencePressure;
+        _referenceAltitude = referenceAltitude;
+        _referenceSeaLevel = seaLevelPressure(referencePressure, referenceAltitude);
+    }
+
+    setSeaLevel(_referenceSeaLevel);
+}
+
+float Barometric_Formula::seaLevel()
+{
+    return _seaLevelPressure;
+}
+
+float Barometric_Formula::altitude(float pressure)
+{
+    return BAROMETRIC_ALTITUDE * (1.0f - barometricPower(pressure * _inverseSeaLevel));
+}
+
+int32_t Barometric_Formula::altitudeFixed(uint32_t pressure)
+{
+    // Ratio as Q2.30
+    uint32_t ratio = (uint32_t)(((uint64_t)pressure * _inverseSeaLevelFixed) >> 24);
+
+    // Altitude in mm
+    return (int32_t)(((int64_t)(BAROMETRIC_ALTITUDE * 1000.0) * ((int64_t)1073741824 - (int64_t)barometricPowerFixed(ratio))) >> 30);
+}
+
+float Barometric_Formula::seaLevelPressure(float pressure, float altitudeMeters)
+{
+    // pow() only when the altitude changes
+    if (altitudeMeters != _altitude)
+    {
+        _altitude = altitudeMeters;
+        _altitudeFactor = 1.0 / pow(1.0 - altitudeMeters / BAROMETRIC_ALTITUDE, 1.0 / BAROMETRIC_EXPONENT);
+    }
+
+    return pressure * _altitudeFactor;
+}
@@ -0,0 +1,145 @@
+///
+/// @file		Sensor_Barometric.h
+/// @brief		Library header
+/// @details	Barometric formula for altitude and sea level pressure, without pow()
+/// @n
+/// @n @b		Project SensorsBoosterPack
+/// @n @a		Developed with [embedXcode+](https://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		https://embeddedcomputing.weebly.com
+///
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2015-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+/// * Pressure Altimetry using the MPL3115A2
+/// @n  http://cache.freescale.com/files/sensors/doc/app_note/AN4528.pdf
+///
+
+#ifndef Sensor_Barometric_RELEASE
+///
+/// @brief	Release
+///
+#define Sensor_Barometric_RELEASE 101
+
+
+// Include core library - IDE-based
+#if defined(WIRING) // Wiring specific
+#include "Wiring.h"
+#elif defined(MAPLE_IDE) // Maple specific
+#include "WProgram.h"
+#elif defined(ROBOTIS) // Robotis specific
+#include "libpandora_types.h"
+#include "pandora.h"
+#elif defined(MPIDE) // chipKIT specific
+#include "WProgram.h"
+#elif defined(DIGISPARK) // Digispark specific
+#include "Arduino.h"
+#elif defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#elif defined(LITTLEROBOTFRIENDS) // LittleRobotFriends specific
+#include "LRF.h"
+#elif defined(MICRODUINO) // Microduino specific
+#include "Arduino.h"
+#elif defined(TEENSYDUINO) // Teensy specific
+#include "Arduino.h"
+#elif defined(REDBEARLAB) // RedBearLab specific
+#include "Arduino.h"
+#elif defined(RFDUINO) // RFduino specific
+#include "Arduino.h"
+#elif defined(SPARK) // Spark specific
+#include "application.h"
+#elif defined(ARDUINO) // Arduino 1.0 and 1.5 specific
+#include "Arduino.h"
+#else // error
+#   error Platform not defined
+#endif // end IDE
+
+
+///
+/// @brief      Barometric formula constants
+/// @details    altitude = BAROMETRIC_ALTITUDE * (1 - (pressure / seaLevelPressure) ^ BAROMETRIC_EXPONENT)
+/// @{
+#define BAROMETRIC_ALTITUDE 44330.77 ///< altitude scale, in metre
+#define BAROMETRIC_EXPONENT 0.190263 ///< exponent = 1 / 5.255876
+/// @}
+
+///
+/// @brief      Barometric formula with cached sea level pressure
+/// @details    The power function is approximated by a 66-entry table with quadratic interpolation.
+/// @n          Error on altitude against pow(), for ratio pressure / sea level pressure in 0.25..1.25:
+/// * < 0.012 m from -500 to 3000 m
+/// * < 0.025 m up to 5500 m
+/// * < 0.09 m up to 9000 m
+/// @n          The fixed-point variant stays within the same bounds.
+/// @note       The sea level pressure and the altitude factor are only recomputed when the reference changes.
+///
+class Barometric_Formula
+{
+  public:
+    ///
+    /// @brief	Constructor
+    /// @param  seaLevelPressure pressure at sea level, in hPa, default=1013.25
+    ///
+    Barometric_Formula(float seaLevelPressure = 1013.250);
+
+    ///
+    /// @brief	Set sea level pressure
+    /// @param  seaLevelPressure pressure at sea level, in hPa
+    ///
+    void setSeaLevel(float seaLevelPressure);
+
+    ///
+    /// @brief	Set sea level pressure from reference pressure and altitude
+    /// @param  referencePressure reference pressure, in hPa
+    /// @param  referenceAltitude reference altitude, in meter
+    /// @note   The reference is a measure of the pressure at a known altitude.
+    ///
+    void setReference(float referencePressure, float referenceAltitude);
+
+    ///
+    /// @brief	Sea level pressure
+    /// @return pressure at sea level, in hPa
+    ///
+    float seaLevel();
+
+    ///
+    /// @brief	Altitude based on pressure
+    /// @param  pressure pressure, in hPa
+    /// @return altitude, in meter
+    ///
+    float altitude(float pressure);
+
+    ///
+    /// @brief	Altitude based on pressure, fixed-point
+    /// @param  pressure pressure, in Pa as Q24.8, as returned by the Bosch integer formula
+    /// @return altitude, in millimetre
+    ///
+    int32_t altitudeFixed(uint32_t pressure);
+
+    ///
+    /// @brief	Absolute pressure, equivalent at sea level
+    /// @param  pressure pressure, in hPa
+    /// @param  altitudeMeters current altitude, in meter
+    /// @return absolute pressure at sea level, in hPa
+    ///
+    float seaLevelPressure(float pressure, float altitudeMeters);
+
+  private:
+    float _seaLevelPressure;
+    float _inverseSeaLevel;
+    uint32_t _inverseSeaLevelFixed;
+
+    float _referencePressure;
+    float _referenceAltitude;
+    float _referenceSeaLevel;
+
+    float _altitude;
+    float _altitudeFactor;
+};
+
+#endif
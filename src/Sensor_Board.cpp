@@ -0,0 +1,248 @@
+//
+// Sensor_Board.cpp
+// Library C++ code
+// ----------------------------------
+// Developed with embedXcode+
+// https://embedXcode.weebly.com
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// See 			Sensor_Board.h and ReadMe.txt for references
+//
+
+
+// Include library header
+#include "Sensor_Board.h"
+
+// Identity of each sensor: register, 2 bytes MSB first, mask and value
+struct board_identity_s
+{
+    uint8_t device;
+    uint8_t command;
+    uint16_t mask;
+    uint16_t value;
+};
+
+static const board_identity_s identities[] =
+{
+    { SENSOR_DEVICE_TMP007, 0xff, 0xffff, 0x0078 }, // device ID
+    { SENSOR_DEVICE_TMP116, 0x0f, 0x0fff, 0x0116 }, // device ID, without revision
+    { SENSOR_DEVICE_HDC1000, 0xff, 0xffff, 0x1000 }, // device ID
+    { SENSOR_DEVICE_HDC2080, 0xfe, 0xffff, 0xd007 }, // device ID, LSB first
+    { SENSOR_DEVICE_OPT3001, 0x7f, 0xffff, 0x3001 }, // device ID
+    { SENSOR_DEVICE_BMP280, 0xd0, 0xff00, 0x5800 }, // chip ID
+    { SENSOR_DEVICE_BME280, 0xd0, 0xff00, 0x6000 }, // chip ID
+};
+
+// Sensors of each board, required ones identify the board
+struct board_entry_s
+{
+    uint8_t board;
+    uint8_t device;
+    uint8_t address;
+    bool required;
+};
+
+// Most specific boards first
+static const board_entry_s entries[] =
+{
+    { SENSOR_BOARD_SENSORTAG_CC1350, SENSOR_DEVICE_TMP007, 0x44, true },
+    { SENSOR_BOARD_SENSORTAG_CC1350, SENSOR_DEVICE_OPT3001, 0x45, true },
+    { SENSOR_BOARD_SENSORTAG_CC1350, SENSOR_DEVICE_HDC1000, 0x43, true },
+    { SENSOR_BOARD_SENSORTAG_CC1350, SENSOR_DEVICE_BMP280, 0x77, true },
+    { SENSOR_BOARD_SENSORS_BOOSTERPACK, SENSOR_DEVICE_TMP007, 0x40, true },
+    { SENSOR_BOARD_SENSORS_BOOSTERPACK, SENSOR_DEVICE_OPT3001, 0x47, true },
+    { SENSOR_BOARD_SENSORS_BOOSTERPACK, SENSOR_DEVICE_BME280, 0x77, true },
+    { SENSOR_BOARD_BASS, SENSOR_DEVICE_TMP116, 0x48, true },
+    { SENSOR_BOARD_BASS, SENSOR_DEVICE_OPT3001, 0x44, true },
+    { SENSOR_BOARD_BASS, SENSOR_DEVICE_HDC1000, 0x40, false },
+    { SENSOR_BOARD_BASS, SENSOR_DEVICE_HDC2080, 0x40, false },
+    { SENSOR_BOARD_LPSTK_CC1352, SENSOR_DEVICE_HDC2080, 0x41, true },
+    { SENSOR_BOARD_LPSTK_CC1352, SENSOR_DEVICE_OPT3001, 0x44, true },
+};
+
+#define BOARD_ENTRIES (sizeof(entries) / sizeof(entries[0]))
+#define BOARD_IDENTITIES (sizeof(identities) / sizeof(identities[0]))
+
+// Read without waiting on an absent device
+static bool probeRegister16(uint8_t address, uint8_t command, uint16_t & value)
+{
+    Wire.beginTransmission(address);
+    Wire.write(command);
+    if (Wire.endTransmission() != 0)
+    {
+        return false;
+    }
+
+    if (Wire.requestFrom(address, (uint8_t)2) != 2)
+    {
+        return false;
+    }
+    value = Wire.read() << 8;
+    value |= Wire.read();
+    return true;
+}
+
+// Code
+Sensor_Board::Sensor_Board()
+{
+    _profile.magic = BOARD_PROFILE_MAGIC;
+    _profile.board = SENSOR_BOARD_UNKNOWN;
+    _profile.count = 0;
+    _profile.check = check(&_profile);
+}
+
+sensor_board_e Sensor_Board::probe(uint32_t timeout)
+{
+    uint32_t chrono = millis();
+    bool complete = true;
+    bool absent[BOARD_ENTRIES];
+
+    _profile.board = SENSOR_BOARD_UNKNOWN;
+    _profile.count = 0;
+
+    for (uint8_t entry = 0; entry < BOARD_ENTRIES; entry++)
+    {
+        absent[entry] = false;
+        if (millis() - chrono > timeout)
+        {
+            complete = false;
+            break;
+        }
+
+        uint8_t device = entries[entry].device;
+        uint8_t address = entries[entry].address;
+
+        // Skip pairs already probed, and addresses already found absent
+        bool skip = found(device, address);
+        for (uint8_t previous = 0; previous < entry; previous++)
+        {
+            if ((entries[previous].address == address) and absent[previous])
+            {
+                skip = true;
+            }
+        }
+        if (skip)
+        {
+            continue;
+        }
+
+        for (uint8_t index = 0; index < BOARD_IDENTITIES; index++)
+        {
+            if (identities[index].device == device)
+            {
+                uint16_t value;
+                if (not probeRegister16(address, identities[index].command, value))
+                {
+                    absent[entry] = true;
+                }
+                else if (((value & identities[index].mask) == identities[index].value) and (_profile.count < BOARD_SENSORS))
+                {
+                    _profile.sensors[_profile.count].device = device;
+                    _profile.sensors[_profile.count].address = address;
+                    _profile.count++;
+                }
+            }
+        }
+    }
+
+    // First board with all its required sensors
+    if (complete)
+    {
+        for (uint8_t entry = 0; entry < BOARD_ENTRIES; entry++)
+        {
+            uint8_t board = entries[entry].board;
+            bool match = true;
+            for (uint8_t other = 0; other < BOARD_ENTRIES; other++)
+            {
+                if ((entries[other].board == board) and entries[other].required and not found(entries[other].device, entries[other].address))
+                {
+                    match = false;
+                }
+            }
+            if (match)
+            {
+                _profile.board = board;
+                break;
+            }
+        }
+    }
+
+    _profile.check = check(&_profile);
+    return (sensor_board_e)_profile.board;
+}
+
+bool Sensor_Board::restore(const board_profile_s * cached)
+{
+    if ((cached->magic != BOARD_PROFILE_MAGIC) or (cached->count > BOARD_SENSORS) or (cached->check != check(cached)))
+    {
+        return false;
+    }
+    _profile = *cached;
+    return true;
+}
+
+const board_profile_s * Sensor_Board::profile()
+{
+    return &_profile;
+}
+
+sensor_board_e Sensor_Board::board()
+{
+    return (sensor_board_e)_profile.board;
+}
+
+uint8_t Sensor_Board::address(sensor_device_e device)
+{
+    for (uint8_t index = 0; index < _profile.count; index++)
+    {
+        if (_profile.sensors[index].device == device)
+        {
+            return _profile.sensors[index].address;
+        }
+    }
+    return 0;
+}
+
+// CRC-16 CCITT, polynomial 0x1021, bitwise to save the table
+static uint16_t crc16(uint16_t crc, uint8_t data)
+{
+    crc ^= (uint16_t)data << 8;
+    for (uint8_t bit = 0; bit < 8; bit++)
+    {
+        crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+    }
+    return crc;
+}
+
+uint16_t Sensor_Board::check(const board_profile_s * profile)
+{
+    // Initial value 0xffff, so blank memory is not valid
+    uint16_t result = 0xffff;
+    result = crc16(result, profile->board);
+    result = crc16(result, profile->count);
+    for (uint8_t index = 0; (index < profile->count) and (index < BOARD_SENSORS); index++)
+    {
+        result = crc16(result, profile->sensors[index].device);
+        result = crc16(result, profile->sensors[index].address);
+    }
+    return result;
+}
+
+bool Sensor_Board::found(uint8_t device, uint8_t address)
+{
+    for (uint8_t index = 0; index < _profile.count; index++)
+    {
+        if ((_profile.sensors[index].device == device) and (_profile.sensors[index].address == address))
+        {
+            return true;
+        }
+    }
+    return false;
+}
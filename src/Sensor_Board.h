@@ -0,0 +1,185 @@
+///
+/// @file		Sensor_Board.h
+/// @brief		Library header
+/// @details	Board detection by probing the I²C bus
+/// @n
+/// @n @b		Project SensorsBoosterPack
+/// @n @a		Developed with [embedXcode+](https://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		https://embeddedcomputing.weebly.com
+///
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2015-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+///
+
+#ifndef Sensor_Board_RELEASE
+///
+/// @brief	Release
+///
+#define Sensor_Board_RELEASE 101
+
+
+// Include core library - IDE-based
+#if defined(WIRING) // Wiring specific
+#include "Wiring.h"
+#elif defined(MAPLE_IDE) // Maple specific
+#include "WProgram.h"
+#elif defined(ROBOTIS) // Robotis specific
+#include "libpandora_types.h"
+#include "pandora.h"
+#elif defined(MPIDE) // chipKIT specific
+#include "WProgram.h"
+#elif defined(DIGISPARK) // Digispark specific
+#include "Arduino.h"
+#elif defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#elif defined(LITTLEROBOTFRIENDS) // LittleRobotFriends specific
+#include "LRF.h"
+#elif defined(MICRODUINO) // Microduino specific
+#include "Arduino.h"
+#elif defined(TEENSYDUINO) // Teensy specific
+#include "Arduino.h"
+#elif defined(REDBEARLAB) // RedBearLab specific
+#include "Arduino.h"
+#elif defined(RFDUINO) // RFduino specific
+#include "Arduino.h"
+#elif defined(SPARK) // Spark specific
+#include "application.h"
+#elif defined(ARDUINO) // Arduino 1.0 and 1.5 specific
+#include "Arduino.h"
+#else // error
+#   error Platform not defined
+#endif // end IDE
+
+#include "Wire.h"
+#include "Sensor_Device.h"
+
+///
+/// @brief      Maximum number of sensors on a board
+///
+#define BOARD_SENSORS 6
+
+///
+/// @brief      Default probing time limit, ms
+///
+#define BOARD_PROBE_TIMEOUT 50
+
+///
+/// @brief      Marker of a valid profile, "SB"
+///
+#define BOARD_PROFILE_MAGIC 0x5342
+
+///
+/// @brief      Board identifiers
+///
+enum sensor_board_e
+{
+    SENSOR_BOARD_UNKNOWN = 0, ///< no known board, sensors may have been found
+    SENSOR_BOARD_SENSORS_BOOSTERPACK = 1, ///< Sensors BoosterPack, TMP007 + OPT3001 + BME280
+    SENSOR_BOARD_BASS = 2, ///< Building Automation System Sensors BoosterPack, TMP116 + OPT3001 + HDC
+    SENSOR_BOARD_SENSORTAG_CC1350 = 3, ///< SensorTag CC1350, TMP007 + OPT3001 + HDC1000 + BMP280
+    SENSOR_BOARD_LPSTK_CC1352 = 4, ///< LaunchPad SensorTag Kit CC1352, HDC2080 + OPT3001
+};
+
+///
+/// @brief      Sensor found on the bus
+///
+struct board_sensor_s
+{
+    uint8_t device; ///< sensor_device_e
+    uint8_t address; ///< I²C address, 7-bit
+};
+
+///
+/// @brief      Result of the probe, to be cached
+/// @note       Plain data, can be kept in retained RAM or in flash between boots.
+/// @n          Validated by a magic word and a CRC-16, so random .noinit RAM is rejected.
+///
+struct board_profile_s
+{
+    uint16_t magic; ///< BOARD_PROFILE_MAGIC
+    uint8_t board; ///< sensor_board_e
+    uint8_t count; ///< number of sensors
+    board_sensor_s sensors[BOARD_SENSORS]; ///< sensors found
+    uint16_t check; ///< CRC-16 CCITT of board, count and sensors found
+};
+
+///
+/// @brief      Board detection
+/// @details    Probes the addresses of the known boards and checks the identity of each sensor
+///             with its device identifier register.
+/// @note       The drivers are not instantiated: address() provides the address,
+///             the application constructs the driver, statically, as below.
+/// @code
+///    Sensor_Board myBoard;
+///    if (not myBoard.restore(&cachedProfile))
+///    {
+///        Wire.begin();
+///        myBoard.probe();
+///        cachedProfile = *myBoard.profile();
+///    }
+///    uint8_t address = myBoard.address(SENSOR_DEVICE_OPT3001);
+///    if (address > 0)
+///    {
+///        static Sensor_OPT3001 sensor(address);
+///        myOPT3001 = &sensor;
+///    }
+/// @endcode
+///
+class Sensor_Board
+{
+  public:
+    ///
+    /// @brief	Constructor
+    ///
+    Sensor_Board();
+
+    ///
+    /// @brief	Probe the I²C bus
+    /// @param	timeout time limit, ms, default=BOARD_PROBE_TIMEOUT
+    /// @return	board identifier, SENSOR_BOARD_UNKNOWN if none matches or time is over
+    /// @note   Call Wire.begin() before. An absent address costs one NACKed write only.
+    ///
+    sensor_board_e probe(uint32_t timeout = BOARD_PROBE_TIMEOUT);
+
+    ///
+    /// @brief	Restore a previous result, without bus traffic
+    /// @param	cached profile from a previous probe()
+    /// @return	true if the profile is valid and restored, false otherwise
+    /// @note   Valid means magic word, count and CRC-16 match.
+    ///
+    bool restore(const board_profile_s * cached);
+
+    ///
+    /// @brief	Result of the probe
+    /// @return	profile to be cached
+    ///
+    const board_profile_s * profile();
+
+    ///
+    /// @brief	Board
+    /// @return	board identifier
+    ///
+    sensor_board_e board();
+
+    ///
+    /// @brief	Address of a sensor
+    /// @param	device device identifier
+    /// @return	I²C address of the first sensor of this type, 0 if not found
+    ///
+    uint8_t address(sensor_device_e device);
+
+  private:
+    uint16_t check(const board_profile_s * profile);
+    bool found(uint8_t device, uint8_t address);
+
+    board_profile_s _profile;
+};
+
+#endif
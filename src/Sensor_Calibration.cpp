@@ -0,0 +1,174 @@
+//
+// Sensor_Calibration.cpp
+// Library C++ code
+// ----------------------------------
+// Developed with embedXcode+
+// https://embedXcode.weebly.com
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// See 			Sensor_Calibration.h and ReadMe.txt for references
+//
+
+
+// Include library header
+#include "Sensor_Calibration.h"
+
+#define CALIBRATION_VERSION 1
+
+// Code
+Calibration_Table::Calibration_Table()
+{
+    clear();
+}
+
+void Calibration_Table::clear()
+{
+    _count = 0;
+}
+
+bool Calibration_Table::set(const int32_t * measured, const int32_t * reference, uint8_t count)
+{
+    clear();
+
+    if ((count == 0) or (count > CALIBRATION_POINTS))
+    {
+        return false;
+    }
+
+    for (uint8_t index = 0; index < count; index++)
+    {
+        if ((index > 0) and (measured[index] <= measured[index - 1]))
+        {
+            return false;
+        }
+        _measured[index] = measured[index];
+        _reference[index] = reference[index];
+    }
+
+    // Slopes, Q16.16; a single point means gain = 1
+    _slope[0] = 0x10000;
+    for (uint8_t index = 0; index + 1 < count; index++)
+    {
+        int64_t delta = (int64_t)(_reference[index + 1] - _reference[index]) << 16;
+        _slope[index] = (int32_t)(delta / (int64_t)(_measured[index + 1] - _measured[index]));
+    }
+
+    _count = count;
+    return true;
+}
+
+uint8_t Calibration_Table::count()
+{
+    return _count;
+}
+
+int32_t Calibration_Table::apply(int32_t value)
+{
+    if (_count == 0)
+    {
+        return value;
+    }
+
+    // Segment, first and last extrapolated
+    uint8_t index = 0;
+    while ((index + 2 < _count) and (value >= _measured[index + 1]))
+    {
+        index++;
+    }
+
+    return _reference[index] + (int32_t)(((int64_t)(value - _measured[index]) * _slope[index] + 0x8000) >> 16);
+}
+
+// Little-endian helpers
+static void writeInt32(uint8_t * buffer, int32_t value)
+{
+    for (uint8_t index = 0; index < 4; index++)
+    {
+        buffer[index] = (uint8_t)((uint32_t)value >> (8 * index));
+    }
+}
+
+static int32_t readInt32(const uint8_t * buffer)
+{
+    uint32_t value = 0;
+    for (uint8_t index = 0; index < 4; index++)
+    {
+        value |= (uint32_t)buffer[index] << (8 * index);
+    }
+    return (int32_t)value;
+}
+
+static uint8_t checksum(const uint8_t * buffer, size_t size)
+{
+    uint8_t result = 0;
+    for (size_t index = 0; index < size; index++)
+    {
+        result ^= buffer[index];
+    }
+    return result;
+}
+
+size_t Calibration_Table::serialise(uint8_t * buffer, size_t size)
+{
+    size_t length = 3 + 8 * _count;
+    if (size < length)
+    {
+        return 0;
+    }
+
+    buffer[0] = CALIBRATION_VERSION;
+    buffer[1] = _count;
+    for (uint8_t index = 0; index < _count; index++)
+    {
+        writeInt32(buffer + 2 + 8 * index, _measured[index]);
+        writeInt32(buffer + 6 + 8 * index, _reference[index]);
+    }
+    buffer[length - 1] = checksum(buffer, length - 1);
+
+    return length;
+}
+
+bool Calibration_Table::deserialise(const uint8_t * buffer, size_t size)
+{
+    if ((size < 3) or (buffer[0] != CALIBRATION_VERSION) or (buffer[1] > CALIBRATION_POINTS))
+    {
+        return false;
+    }
+
+    uint8_t count = buffer[1];
+    size_t length = 3 + 8 * count;
+    if ((size < length) or (checksum(buffer, length - 1) != buffer[length - 1]))
+    {
+        return false;
+    }
+
+    if (count == 0)
+    {
+        clear();
+        return true;
+    }
+
+    int32_t measured[CALIBRATION_POINTS];
+    int32_t reference[CALIBRATION_POINTS];
+    for (uint8_t index = 0; index < count; index++)
+    {
+        measured[index] = readInt32(buffer + 2 + 8 * index);
+        reference[index] = readInt32(buffer + 6 + 8 * index);
+    }
+
+    // Keep the current table if the blob is not valid
+    Calibration_Table check;
+    if (not check.set(measured, reference, count))
+    {
+        return false;
+    }
+    *this = check;
+    return true;
+}
@@ -0,0 +1,147 @@
+///
+/// @file		Sensor_Calibration.h
+/// @brief		Library header
+/// @details	Software calibration in fixed point, for sensors without offset registers
+/// @n
+/// @n @b		Project SensorsBoosterPack
+/// @n @a		Developed with [embedXcode+](https://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		https://embeddedcomputing.weebly.com
+///
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2015-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+///
+
+#ifndef Sensor_Calibration_RELEASE
+///
+/// @brief	Release
+///
+#define Sensor_Calibration_RELEASE 101
+
+
+// Include core library - IDE-based
+#if defined(WIRING) // Wiring specific
+#include "Wiring.h"
+#elif defined(MAPLE_IDE) // Maple specific
+#include "WProgram.h"
+#elif defined(ROBOTIS) // Robotis specific
+#include "libpandora_types.h"
+#include "pandora.h"
+#elif defined(MPIDE) // chipKIT specific
+#include "WProgram.h"
+#elif defined(DIGISPARK) // Digispark specific
+#include "Arduino.h"
+#elif defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#elif defined(LITTLEROBOTFRIENDS) // LittleRobotFriends specific
+#include "LRF.h"
+#elif defined(MICRODUINO) // Microduino specific
+#include "Arduino.h"
+#elif defined(TEENSYDUINO) // Teensy specific
+#include "Arduino.h"
+#elif defined(REDBEARLAB) // RedBearLab specific
+#include "Arduino.h"
+#elif defined(RFDUINO) // RFduino specific
+#include "Arduino.h"
+#elif defined(SPARK) // Spark specific
+#include "application.h"
+#elif defined(ARDUINO) // Arduino 1.0 and 1.5 specific
+#include "Arduino.h"
+#else // error
+#   error Platform not defined
+#endif // end IDE
+
+
+///
+/// @brief      Maximum number of calibration points
+///
+#define CALIBRATION_POINTS 4
+
+///
+/// @brief      Size of the serialised table, in bytes
+/// @details    version + count + CALIBRATION_POINTS * (measured + reference) + checksum
+///
+#define CALIBRATION_BLOB_SIZE (3 + CALIBRATION_POINTS * 8)
+
+///
+/// @brief      Calibration table
+/// @details    Piecewise-linear correction on the integer value of a sensor, right after the raw decoding.
+/// * 1 point = offset
+/// * 2 points = gain and offset
+/// * 3 to CALIBRATION_POINTS points = piecewise linear, extrapolated beyond the first and last points
+/// @n          Slopes are pre-computed as Q16.16, so apply() costs a multiply and a shift.
+/// @note       The table is owned by the application and attached to the sensor with setCalibration().
+/// @code
+///    // TMP116 integer unit is 1/128 °C: 0 °C reads +0.1 °C, 50 °C reads 49.93 °C
+///    int32_t measured[2] = { 13, 6391 };
+///    int32_t reference[2] = { 0, 6400 };
+///    myCalibration.set(measured, reference, 2);
+///    myTMP116.setCalibration(&myCalibration);
+/// @endcode
+///
+class Calibration_Table
+{
+  public:
+    ///
+    /// @brief	Constructor, empty table
+    ///
+    Calibration_Table();
+
+    ///
+    /// @brief	Empty the table, apply() returns the value unchanged
+    ///
+    void clear();
+
+    ///
+    /// @brief	Set the calibration points
+    /// @param	measured values measured by the sensor, in the integer unit of the sensor, strictly increasing
+    /// @param	reference reference values, in the same unit
+    /// @param	count number of points, 1..CALIBRATION_POINTS
+    /// @return	true if the table is valid, false otherwise and the table is cleared
+    ///
+    bool set(const int32_t * measured, const int32_t * reference, uint8_t count);
+
+    ///
+    /// @brief	Number of points
+    /// @return	number of points, 0 = empty table
+    ///
+    uint8_t count();
+
+    ///
+    /// @brief	Apply the calibration
+    /// @param	value value measured by the sensor, in the integer unit of the sensor
+    /// @return	calibrated value, in the same unit
+    ///
+    int32_t apply(int32_t value);
+
+    ///
+    /// @brief	Serialise the table
+    /// @param	buffer buffer for the blob, at least CALIBRATION_BLOB_SIZE bytes
+    /// @param	size size of the buffer
+    /// @return	number of bytes written, 0 if the buffer is too small
+    /// @note   Little-endian, 3 + 8 * count() bytes.
+    ///
+    size_t serialise(uint8_t * buffer, size_t size);
+
+    ///
+    /// @brief	Load the table from a blob
+    /// @param	buffer blob from serialise()
+    /// @param	size size of the blob
+    /// @return	true if the blob is valid, false otherwise and the table is unchanged
+    ///
+    bool deserialise(const uint8_t * buffer, size_t size);
+
+  private:
+    int32_t _measured[CALIBRATION_POINTS];
+    int32_t _reference[CALIBRATION_POINTS];
+    int32_t _slope[CALIBRATION_POINTS]; // Q16.16, for segment index..index + 1
+    uint8_t _count;
+};
+
+#endif
@@ -0,0 +1,87 @@
+///
+/// @file		Sensor_Device.h
+/// @brief		Library header
+/// @details	Build options and device identifiers shared by all sensors
+/// @n
+/// @n @b		Project SensorsBoosterPack
+/// @n @a		Developed with [embedXcode+](https://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		https://embeddedcomputing.weebly.com
+///
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2015-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+///
+
+#ifndef Sensor_Device_RELEASE
+///
+/// @brief	Release
+///
+#define Sensor_Device_RELEASE 101
+
+
+// Include core library - IDE-based
+#if defined(WIRING) // Wiring specific
+#include "Wiring.h"
+#elif defined(MAPLE_IDE) // Maple specific
+#include "WProgram.h"
+#elif defined(ROBOTIS) // Robotis specific
+#include "libpandora_types.h"
+#include "pandora.h"
+#elif defined(MPIDE) // chipKIT specific
+#include "WProgram.h"
+#elif defined(DIGISPARK) // Digispark specific
+#include "Arduino.h"
+#elif defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#elif defined(LITTLEROBOTFRIENDS) // LittleRobotFriends specific
+#include "LRF.h"
+#elif defined(MICRODUINO) // Microduino specific
+#include "Arduino.h"
+#elif defined(TEENSYDUINO) // Teensy specific
+#include "Arduino.h"
+#elif defined(REDBEARLAB) // RedBearLab specific
+#include "Arduino.h"
+#elif defined(RFDUINO) // RFduino specific
+#include "Arduino.h"
+#elif defined(SPARK) // Spark specific
+#include "application.h"
+#elif defined(ARDUINO) // Arduino 1.0 and 1.5 specific
+#include "Arduino.h"
+#else // error
+#   error Platform not defined
+#endif // end IDE
+
+
+///
+/// @brief      Heap-free build
+/// @details    * 0 = default, WhoAmI() returns a String
+/// @n          * 1 = no String anywhere in the library, WhoAmI() returns a const char* and no function allocates memory
+/// @note       Define SENSOR_HEAP_FREE as a build flag or edit the value below.
+///
+#ifndef SENSOR_HEAP_FREE
+#define SENSOR_HEAP_FREE 0
+#endif
+
+///
+/// @brief      Device identifiers
+/// @details    Returned by deviceType() of each sensor
+///
+enum sensor_device_e
+{
+    SENSOR_DEVICE_UNKNOWN = 0, ///< unknown
+    SENSOR_DEVICE_TMP007  = 1, ///< TMP007 infra-red thermometer
+    SENSOR_DEVICE_TMP116  = 2, ///< TMP116 thermometer
+    SENSOR_DEVICE_HDC1000 = 3, ///< HDC1000 thermometer and hydrometer
+    SENSOR_DEVICE_HDC2080 = 4, ///< HDC2080 thermometer and hydrometer
+    SENSOR_DEVICE_OPT3001 = 5, ///< OPT3001 light sensor
+    SENSOR_DEVICE_BMP280  = 6, ///< BMP280 thermometer and barometer
+    SENSOR_DEVICE_BME280  = 7, ///< BME280 thermometer, barometer and hydrometer
+};
+
+#endif
@@ -29,6 +29,11 @@
 Sensor_HDC1000::Sensor_HDC1000(uint8_t address)
 {
     _address = address;
+    _configuration = HDC1000_SETTINGS;
+    _rawTemperature = 0;
+    _rawHumidity = 0;
+    _channel = HDC1000_TEMPERATURE_AND_HUMIDITY;
+    _triggered = false;
 }
 
 void Sensor_HDC1000::begin(uint8_t configuration)
@@ -39,6 +44,7 @@ void Sensor_HDC1000::begin(uint8_t configuration)
     // 0001 0000 0000 0000
 
     configuration |= HDC1000_MODE_SEQUENCE;
+    _configuration = configuration & ~HDC1000_RESET;
 
 //    writeRegister88(_address, HDC1000_CONFIGURATION, configuration, 0x00);
     Wire.beginTransmission(_address);
@@ -48,32 +54,142 @@ void Sensor_HDC1000::begin(uint8_t configuration)
     Wire.endTransmission();
 }
 
-void Sensor_HDC1000::get()
+#if (SENSOR_HEAP_FREE == 1)
+const char * Sensor_HDC1000::WhoAmI()
+#else
+String Sensor_HDC1000::WhoAmI()
+#endif
 {
-    // Doesn't work because a delay is required
-    //     _rawTemperature = readRegister16(_address, HDC1000_TEMPERATURE);
-    //     _rawHumidity    = readRegister16(_address, HDC1000_HUMIDITY);
-    //     Serial.println(_rawTemperature, DEC);
-    //     Serial.println(_rawHumidity, DEC);
+    return "HDC1000 temperature + humidity";
+}
+
+sensor_device_e Sensor_HDC1000::deviceType()
+{
+    return SENSOR_DEVICE_HDC1000;
+}
 
+void Sensor_HDC1000::setAccuracy(float temperatureAccuracy, float humidityAccuracy)
+{
+    _configuration &= ~(HDC1000_TEMPERATURE_11_BITS | HDC1000_HUMIDITY_11_BITS | HDC1000_HUMIDITY_8_BITS);
+
+    // Resolution = 165 °C / 2^bits
+    if (temperatureAccuracy >= 165.0 / 2048.0)
+    {
+        _configuration |= HDC1000_TEMPERATURE_11_BITS;
+    }
+
+    // Resolution = 100 % / 2^bits
+    if (humidityAccuracy >= 100.0 / 256.0)
+    {
+        _configuration |= HDC1000_HUMIDITY_8_BITS;
+    }
+    else if (humidityAccuracy >= 100.0 / 2048.0)
+    {
+        _configuration |= HDC1000_HUMIDITY_11_BITS;
+    }
+
+    writeRegister16(_address, HDC1000_CONFIGURATION, _configuration << 8);
+}
+
+uint32_t Sensor_HDC1000::conversionTime(uint8_t channel)
+{
+    // Table 7.5 Electrical Characteristics, conversion time in us
+    uint32_t result = 0;
+
+    if (channel != HDC1000_HUMIDITY_ONLY)
+    {
+        result += (_configuration & HDC1000_TEMPERATURE_11_BITS) ? 3650 : 6350;
+    }
+
+    if (channel != HDC1000_TEMPERATURE_ONLY)
+    {
+        if (_configuration & HDC1000_HUMIDITY_8_BITS)
+        {
+            result += 2500;
+        }
+        else if (_configuration & HDC1000_HUMIDITY_11_BITS)
+        {
+            result += 3850;
+        }
+        else
+        {
+            result += 6500;
+        }
+    }
+    return result;
+}
+
+void Sensor_HDC1000::triggerMeasurement(uint8_t channel)
+{
+    // Sequence mode for both channels, mode either for a single channel, set on change only
+    uint8_t mode = (channel == HDC1000_TEMPERATURE_AND_HUMIDITY) ? HDC1000_MODE_SEQUENCE : HDC1000_MODE_EITHER;
+    if ((_configuration & HDC1000_MODE_SEQUENCE) != mode)
+    {
+        _configuration = (_configuration & ~HDC1000_MODE_SEQUENCE) | mode;
+        writeRegister16(_address, HDC1000_CONFIGURATION, _configuration << 8);
+    }
+
+    // Writing the pointer triggers the conversion
     Wire.beginTransmission(_address);
-    Wire.write(HDC1000_TEMPERATURE);
+    Wire.write((channel == HDC1000_HUMIDITY_ONLY) ? HDC1000_HUMIDITY : HDC1000_TEMPERATURE);
     Wire.endTransmission();
 
-    // delay(20);
-    uint32_t chrono = millis() + 20;
-    while (millis() < chrono);
-    // Table 7.5 Electrical Characteristics
-    // Actually 10 ms for temperature + 10 ms for humidity
-
-    Wire.requestFrom(_address, 4);
-    while (Wire.available() < 4);
+    _channel = channel;
+    _triggered = true;
+}
 
-    _rawTemperature  = Wire.read() << 8;
-    _rawTemperature |= Wire.read();
+uint8_t Sensor_HDC1000::readMeasurement()
+{
+    if (not _triggered)
+    {
+        return HDC1000_STALE;
+    }
+
+    // The HDC1000 NACKs the read until the conversion is done
+    uint8_t length = (_channel == HDC1000_TEMPERATURE_AND_HUMIDITY) ? 4 : 2;
+    if ((Wire.requestFrom(_address, length) < length) or (Wire.available() < length))
+    {
+        return HDC1000_STALE;
+    }
+
+    uint8_t data[4];
+    for (uint8_t index = 0; index < length; index++)
+    {
+        data[index] = Wire.read();
+    }
+    _triggered = false;
+
+    if (_channel == HDC1000_HUMIDITY_ONLY)
+    {
+        _rawHumidity = (data[0] << 8) | data[1];
+    }
+    else
+    {
+        _rawTemperature = (data[0] << 8) | data[1];
+    }
+    if (length == 4)
+    {
+        _rawHumidity = (data[2] << 8) | data[3];
+    }
+    return HDC1000_FRESH;
+}
 
-    _rawHumidity  = Wire.read() << 8;
-    _rawHumidity |= Wire.read();
+uint8_t Sensor_HDC1000::get(uint8_t channel)
+{
+    triggerMeasurement(channel);
+
+    uint32_t period = conversionTime(channel);
+    uint32_t chrono = micros();
+    while (micros() - chrono < period);
+
+    // Up to 8 more attempts, 250 us apart
+    uint8_t result = readMeasurement();
+    for (uint8_t count = 0; (result == HDC1000_STALE) and (count < 8); count++)
+    {
+        delayMicroseconds(250);
+        result = readMeasurement();
+    }
+    return result;
 }
 
 double Sensor_HDC1000::temperature()
@@ -88,6 +204,16 @@ double Sensor_HDC1000::humidity()
     return (double)_rawHumidity * 100.0 / 65536.0;
 }
 
+uint16_t Sensor_HDC1000::rawTemperature()
+{
+    return _rawTemperature;
+}
+
+uint16_t Sensor_HDC1000::rawHumidity()
+{
+    return _rawHumidity;
+}
+
 void Sensor_HDC1000::setPowerMode(uint8_t mode)
 {
     ;
@@ -55,6 +55,7 @@
 #define Sensor_HDC1000_cpp
 
 #include "Wire.h"
+#include "Sensor_Device.h"
 
 #define HDC1000_I2C_ADDRESS 0x43
 
@@ -77,6 +78,26 @@
 
 #define HDC1000_SETTINGS            0b00010101
 
+///
+/// @brief    Acquisition channels
+/// @{
+#define HDC1000_TEMPERATURE_AND_HUMIDITY 0 ///< temperature and humidity
+#define HDC1000_TEMPERATURE_ONLY    1 ///< temperature
+#define HDC1000_HUMIDITY_ONLY       2 ///< humidity
+/// @}
+
+///
+/// @brief    get() results
+/// @{
+#define HDC1000_FRESH               0 ///< new measurement
+#define HDC1000_STALE               1 ///< conversion not read, previous values kept
+/// @}
+
+///
+/// @brief    Accuracy target for the fastest conversion, see setAccuracy()
+///
+#define HDC1000_FASTEST             1000.0
+
 ///
 /// @brief      Class for sensor HDC1000
 /// @details    Temperature and Humidity Sensor
@@ -95,13 +116,69 @@ class Sensor_HDC1000
     ///
     /// @brief	Initialisation
     /// @param	configuration default=HDC1000_SETTINGS
+    /// @note   HDC1000_MODE_SEQUENCE is always set, as get() of both channels requires it.
     ///
     void begin(uint8_t configuration = HDC1000_SETTINGS);
 
+    ///
+    /// @brief	Who Am I?
+    /// @return	name of the sensor, string
+    ///
+#if (SENSOR_HEAP_FREE == 1)
+    const char * WhoAmI();
+#else
+    String WhoAmI();
+#endif
+
+    ///
+    /// @brief	Device type
+    /// @return	device identifier, SENSOR_DEVICE_HDC1000
+    ///
+    sensor_device_e deviceType();
+
+    ///
+    /// @brief	Set resolutions from accuracy targets
+    /// @param	temperatureAccuracy target, in °C, default=HDC1000_FASTEST
+    /// @param	humidityAccuracy target, in %, default=HDC1000_FASTEST
+    /// @note   The lowest resolution with a step below the target is selected:
+    /// Resolution | Temperature | Humidity
+    /// ---- | ---- | ----
+    /// 14 bits | 0.010 °C, 6.35 ms | 0.006 %, 6.50 ms
+    /// 11 bits | 0.081 °C, 3.65 ms | 0.049 %, 3.85 ms
+    /// 8 bits | | 0.391 %, 2.50 ms
+    ///
+    void setAccuracy(float temperatureAccuracy = HDC1000_FASTEST, float humidityAccuracy = HDC1000_FASTEST);
+
+    ///
+    /// @brief	Conversion time
+    /// @param	channel default=HDC1000_TEMPERATURE_AND_HUMIDITY, HDC1000_TEMPERATURE_ONLY or HDC1000_HUMIDITY_ONLY
+    /// @return	Conversion time for the current resolutions, in us
+    ///
+    uint32_t conversionTime(uint8_t channel = HDC1000_TEMPERATURE_AND_HUMIDITY);
+
     ///
     /// @brief	Acquisition
+    /// @param	channel default=HDC1000_TEMPERATURE_AND_HUMIDITY, HDC1000_TEMPERATURE_ONLY or HDC1000_HUMIDITY_ONLY
+    /// @return	HDC1000_FRESH, or HDC1000_STALE if the HDC1000 has not acknowledged the read
+    /// @note   Performs triggerMeasurement(), waits for conversionTime() of the channel only, then readMeasurement().
+    /// @note   A single channel switches the HDC1000 to HDC1000_MODE_EITHER,
+    ///         both channels switch it back to HDC1000_MODE_SEQUENCE, only on change.
+    ///
+    uint8_t get(uint8_t channel = HDC1000_TEMPERATURE_AND_HUMIDITY);
+
+    ///
+    /// @brief	Start a conversion, without waiting
+    /// @param	channel default=HDC1000_TEMPERATURE_AND_HUMIDITY, HDC1000_TEMPERATURE_ONLY or HDC1000_HUMIDITY_ONLY
+    /// @note   Writing the pointer register starts the conversion. Sets the mode as get().
+    ///
+    void triggerMeasurement(uint8_t channel = HDC1000_TEMPERATURE_AND_HUMIDITY);
+
+    ///
+    /// @brief	Read the conversion started by triggerMeasurement(), without waiting
+    /// @return	HDC1000_FRESH, or HDC1000_STALE if no conversion was triggered or it is not done
+    /// @note   The HDC1000 does not acknowledge the read until the conversion is done.
     ///
-    void get();
+    uint8_t readMeasurement();
 
     ///
     /// @brief	Measure
@@ -115,6 +192,18 @@ class Sensor_HDC1000
     ///
     double humidity();
 
+    ///
+    /// @brief	Raw measure
+    /// @return	Temperature register, 1 LSB = 160 / 2^16 °C from -40 °C
+    ///
+    uint16_t rawTemperature();
+
+    ///
+    /// @brief	Raw measure
+    /// @return	Humidity register, 1 LSB = 100 / 2^16 %
+    ///
+    uint16_t rawHumidity();
+
     ///
     /// @brief    Manage power
     /// @param    mode LOW=default=off, HIGH=on
@@ -124,6 +213,9 @@ class Sensor_HDC1000
 
   private:
     uint8_t  _address;
+    uint8_t  _configuration;
+    uint8_t  _channel; ///< channel of the last triggerMeasurement()
+    bool     _triggered; ///< conversion triggered, not read yet
 
     uint16_t _rawTemperature;
     uint16_t _rawHumidity;
@@ -43,25 +43,239 @@
 #define HDC2080_MID_H 0xfd
 #define HDC2080_DEVICE_ID_L 0xfe
 #define HDC2080_DEVICE_ID_H 0xff
+#define HDC2080_DEVICE_ID_VALUE 0x07d0
 
 Sensor_HDC2080::Sensor_HDC2080(uint8_t address)
 {
     _address = address;
+    _measureConfiguration = HDC2080_MEASURE_SETTINGS;
+    _status = 0;
+    _maxTemperature = 0;
+    _maxHumidity = 0;
+    _interruptPin = 0;
+    _rate = HDC2080_MANUAL;
+    _pending = false;
+    _dataReady = false;
+    _temperatureBand = HDC2080_BAND_NONE;
+    _humidityBand = HDC2080_BAND_NONE;
+}
+
+Sensor_HDC2080 * Sensor_HDC2080::_interruptInstance = NULL;
+
+void Sensor_HDC2080::_interruptISR()
+{
+    if (_interruptInstance != NULL)
+    {
+        _interruptInstance->_pending = true;
+    }
 }
 
 void Sensor_HDC2080::begin(uint8_t configuration, uint8_t measure)
 {
+    delay(beginReset(configuration, measure));
+    beginConfigure();
+}
+
+uint32_t Sensor_HDC2080::beginReset(uint8_t configuration, uint8_t measure)
+{
+    _measureConfiguration = measure & 0xfe;
     writeRegister8(_address, HDC2080_CONFIGURATION, configuration);
-    writeRegister8(_address, HDC2080_MEASURE_CONFIGURATION, measure);
-    delay(50);
-    measure |= 0b00000001; // Trigger measurement
-    writeRegister8(_address, HDC2080_MEASURE_CONFIGURATION, measure);
+    writeRegister8(_address, HDC2080_MEASURE_CONFIGURATION, _measureConfiguration);
+
+    // Settling time after a soft reset only
+    return (configuration & 0b10000000) ? 50 : 0;
+}
+
+uint32_t Sensor_HDC2080::beginConfigure()
+{
+    writeRegister8(_address, HDC2080_MEASURE_CONFIGURATION, _measureConfiguration | 0b00000001); // Trigger measurement
+
+    // µs to ms, rounded up
+    return (conversionTime() + 999) / 1000;
+}
+
+bool Sensor_HDC2080::beginResume(uint8_t configuration, uint8_t measure)
+{
+    uint8_t identity[2];
+    readRegisters(_address, HDC2080_DEVICE_ID_L, identity, 2);
+
+    // 0x0e..0x0f configuration and measure configuration
+    uint8_t settings[2];
+    readRegisters(_address, HDC2080_CONFIGURATION, settings, 2);
+
+    // Soft reset and trigger bits clear themselves
+    if ((((identity[1] << 8) | identity[0]) != HDC2080_DEVICE_ID_VALUE) or
+            ((settings[0] & 0b01111111) != (configuration & 0b01111111)) or
+            ((settings[1] & 0xfe) != (measure & 0xfe)))
+    {
+        begin(configuration, measure);
+        return false;
+    }
+
+    _measureConfiguration = measure & 0xfe;
+    beginConfigure();
+    return true;
+}
+
+#if (SENSOR_HEAP_FREE == 1)
+const char * Sensor_HDC2080::WhoAmI()
+#else
+String Sensor_HDC2080::WhoAmI()
+#endif
+{
+    return "HDC2080 temperature + humidity";
+}
+
+sensor_device_e Sensor_HDC2080::deviceType()
+{
+    return SENSOR_DEVICE_HDC2080;
+}
+
+void Sensor_HDC2080::readBurst(bool withMaximum)
+{
+    // 0x00..0x03 temperature and humidity, 0x04 status, 0x05..0x06 maximum values
+    uint8_t data[7];
+    readRegisters(_address, HDC2080_TEMPERATURE_LOW, data, withMaximum ? 7 : 5);
+
+    _temperature = data[0] | (data[1] << 8);
+    _humidity = data[2] | (data[3] << 8);
+
+    // Flags are cleared on read, threshold flags are kept until event()
+    _status = data[4] | (_status & HDC2080_STATUS_THRESHOLDS);
+
+    if (withMaximum)
+    {
+        _maxTemperature = data[5];
+        _maxHumidity = data[6];
+    }
+}
+
+uint8_t Sensor_HDC2080::get(bool withMaximum)
+{
+    if (_dataReady)
+    {
+        if (not _pending)
+        {
+            return HDC2080_STALE;
+        }
+        _pending = false;
+    }
+
+    // Status is read with the values, it also releases the level-sensitive DRDY output
+    readBurst(withMaximum);
+
+    if (_dataReady)
+    {
+        if (_rate == HDC2080_MANUAL)
+        {
+            triggerMeasurement();
+        }
+        return HDC2080_FRESH;
+    }
+
+    return (_status & HDC2080_STATUS_DATA_READY) ? HDC2080_FRESH : HDC2080_STALE;
+}
+
+void Sensor_HDC2080::attachInterruptPin(uint8_t interruptPin)
+{
+    _interruptPin = interruptPin;
+    _pending = false;
+    _interruptInstance = this;
+
+    // DRDY/INT output enabled, active high, level sensitive
+    setInterruptPolarity(HDC2080_ACTIVE_HIGH);
+    setInterruptMode(HDC2080_LEVEL_MODE);
+    enableInterrupt();
+
+    // Clear any pending flag, so the next event raises the output
+    readInterruptStatus();
+
+    pinMode(_interruptPin, INPUT);
+    attachInterrupt(_interruptPin, _interruptISR, RISING);
+    // Output already high means the rising edge was missed
+    if (digitalRead(_interruptPin) == HIGH)
+    {
+        _pending = true;
+    }
+}
+
+void Sensor_HDC2080::beginDataReady(uint8_t interruptPin, uint8_t rate)
+{
+    _rate = rate;
+    _dataReady = true;
+    setRate(rate);
+    enableDRDYInterrupt();
+    attachInterruptPin(interruptPin);
+
+    // Auto-measurement also starts on the trigger only
+    triggerMeasurement();
+}
+
+void Sensor_HDC2080::endDataReady()
+{
+    if (_interruptPin > 0)
+    {
+        detachInterrupt(_interruptPin);
+        disableDRDYInterrupt();
+        disableInterrupt();
+    }
+    _interruptPin = 0;
+    _dataReady = false;
+    _interruptInstance = NULL;
 }
 
-void Sensor_HDC2080::get()
+bool Sensor_HDC2080::available()
 {
-    _humidity = readRegister16(_address, HDC2080_HUMIDITY_LOW, LSBFIRST);
-    _temperature = readRegister16(_address, HDC2080_TEMPERATURE_LOW, LSBFIRST);
+    return (not _dataReady) or _pending;
+}
+
+uint8_t Sensor_HDC2080::status()
+{
+    return _status;
+}
+
+float Sensor_HDC2080::maxTemperature()
+{
+    // Maximum register = 8 MSB of the temperature register
+    if ((_temperature >> 8) == _maxTemperature)
+    {
+        return temperature();
+    }
+    return float(_maxTemperature) * 165.0 / 256.0 - 40.0 + 273.15;
+}
+
+float Sensor_HDC2080::maxHumidity()
+{
+    // Maximum register = 8 MSB of the humidity register
+    if ((_humidity >> 8) == _maxHumidity)
+    {
+        return humidity();
+    }
+    return float(_maxHumidity) * 100.0 / 256.0;
+}
+
+void Sensor_HDC2080::beginAutoMeasurement(uint8_t rate)
+{
+    _rate = rate;
+    setRate(rate);
+
+    // Start from a clean state
+    readInterruptStatus();
+    writeRegister16(_address, HDC2080_TEMPERATURE_MAX, 0x0000);
+
+    // Auto-measurement starts on the trigger only
+    triggerMeasurement();
+}
+
+uint8_t Sensor_HDC2080::harvest()
+{
+    readBurst(true);
+    _pending = false;
+
+    // Both maximum registers in one write, auto-increment from 0x05 to 0x06
+    writeRegister16(_address, HDC2080_TEMPERATURE_MAX, 0x0000);
+
+    return (_status & HDC2080_STATUS_DATA_READY) ? HDC2080_FRESH : HDC2080_STALE;
 }
 
 double Sensor_HDC2080::temperature(void)
@@ -74,6 +288,16 @@ double Sensor_HDC2080::humidity()
     return float(_humidity) / 65536.0 * 100.0;
 }
 
+uint16_t Sensor_HDC2080::rawTemperature()
+{
+    return _temperature;
+}
+
+uint16_t Sensor_HDC2080::rawHumidity()
+{
+    return _humidity;
+}
+
 void Sensor_HDC2080::setPowerMode(uint8_t mode)
 {
     ;
@@ -108,6 +332,24 @@ float Sensor_HDC2080::rangeCheck(float value, float minValue, float maxValue)
     {
         value = maxValue;
     }
+    return value;
+}
+
+// Threshold register, 8 MSB of the measure, saturated
+// High thresholds are rounded up and low thresholds down, so the band is never narrower than requested
+static uint8_t thresholdRegister(float value, bool high)
+{
+    float content = 256.0 * value;
+    content = high ? ceil(content) : floor(content);
+    if (content > 255.0)
+    {
+        content = 255.0;
+    }
+    else if (content < 0.0)
+    {
+        content = 0.0;
+    }
+    return (uint8_t)content;
 }
 
 
@@ -117,7 +359,7 @@ void Sensor_HDC2080::setLowTemp(float value)
     value = rangeCheck(value, -40.0, 125.0);
 
     // Calculate value to load into register
-    uint8_t _content = (uint8_t)(256.0 * (value + 40.0) / 165.0);
+    uint8_t _content = thresholdRegister((value + 40.0) / 165.0, false);
 
     writeRegister8(_address, HDC2080_TEMPERATURE_THR_L, _content);
 }
@@ -128,7 +370,7 @@ void Sensor_HDC2080::setHighTemp(float value)
     value = rangeCheck(value, -40.0, 125.0);
 
     // Calculate value to load into register
-    uint8_t _content = (uint8_t)(256.0 * (value + 40.0) / 165.0);
+    uint8_t _content = thresholdRegister((value + 40.0) / 165.0, true);
 
     writeRegister8(_address, HDC2080_TEMPERATURE_THR_H, _content);
 }
@@ -139,7 +381,7 @@ void Sensor_HDC2080::setHighHumidity(float value)
     value = rangeCheck(value, 0.0, 100.0);
 
     // Calculate value to load into register
-    uint8_t _content = (uint8_t)(256.0 * value / 100.0);
+    uint8_t _content = thresholdRegister(value / 100.0, true);
 
     writeRegister8(_address, HDC2080_HUMIDITY_THR_H, _content);
 }
@@ -150,7 +392,7 @@ void Sensor_HDC2080::setLowHumidity(float value)
     value = rangeCheck(value, 0.0, 100.0);
 
     // Calculate value to load into register
-    uint8_t _content = (uint8_t)(256.0 * value / 100.0);
+    uint8_t _content = thresholdRegister(value / 100.0, false);
 
     writeRegister8(_address, HDC2080_HUMIDITY_THR_L, _content);
 }
@@ -213,6 +455,7 @@ void Sensor_HDC2080::setTempRes(int resolution)
             _configuration &= 0x3f;
     }
 
+    _measureConfiguration = _configuration & 0xfe;
     writeRegister8(_address, HDC2080_MEASURE_CONFIGURATION, _configuration);
 }
 
@@ -246,6 +489,7 @@ void Sensor_HDC2080::setHumidRes(int resolution)
             _configuration &= 0xcf;
     }
 
+    _measureConfiguration = _configuration & 0xfe;
     writeRegister8(_address, HDC2080_MEASURE_CONFIGURATION, _configuration);
 }
 
@@ -279,6 +523,7 @@ void Sensor_HDC2080::setMeasurementMode(int mode)
             _configuration &= 0xf9;
     }
 
+    _measureConfiguration = _configuration & 0xfe;
     writeRegister8(_address, HDC2080_MEASURE_CONFIGURATION, _configuration);
 }
 
@@ -506,3 +751,290 @@ void Sensor_HDC2080::disableDRDYInterrupt(void)
 
     writeRegister8(_address, HDC2080_INTERRUPT_CONFIGURATION, _content);
 }
+
+// Threshold events
+void Sensor_HDC2080::setTemperatureBand(float low, float high, float hysteresis)
+{
+    _temperatureLow = low;
+    _temperatureHigh = high;
+    _temperatureHysteresis = hysteresis;
+    _temperatureBand = HDC2080_BAND_IN;
+}
+
+void Sensor_HDC2080::setHumidityBand(float low, float high, float hysteresis)
+{
+    _humidityLow = low;
+    _humidityHigh = high;
+    _humidityHysteresis = hysteresis;
+    _humidityBand = HDC2080_BAND_IN;
+}
+
+// Position relative to the band, with hysteresis on the way back
+static uint8_t bandPosition(uint8_t band, float value, float low, float high, float hysteresis)
+{
+    if (value > high)
+    {
+        return HDC2080_BAND_ABOVE;
+    }
+    if (value < low)
+    {
+        return HDC2080_BAND_BELOW;
+    }
+    if ((band == HDC2080_BAND_ABOVE) and (value > high - hysteresis))
+    {
+        return HDC2080_BAND_ABOVE;
+    }
+    if ((band == HDC2080_BAND_BELOW) and (value < low + hysteresis))
+    {
+        return HDC2080_BAND_BELOW;
+    }
+    return HDC2080_BAND_IN;
+}
+
+void Sensor_HDC2080::armThresholds()
+{
+    uint8_t enable = 0;
+
+    if (_temperatureBand != HDC2080_BAND_NONE)
+    {
+        float value = temperature() - 273.15;
+        _temperatureBand = bandPosition(_temperatureBand, value, _temperatureLow, _temperatureHigh, _temperatureHysteresis);
+
+        // Wake on the next transition only
+        switch (_temperatureBand)
+        {
+            case HDC2080_BAND_ABOVE:
+
+                setLowTemp(_temperatureHigh - _temperatureHysteresis);
+                enable |= HDC2080_STATUS_TEMPERATURE_LOW;
+                break;
+
+            case HDC2080_BAND_BELOW:
+
+                setHighTemp(_temperatureLow + _temperatureHysteresis);
+                enable |= HDC2080_STATUS_TEMPERATURE_HIGH;
+                break;
+
+            default:
+
+                setLowTemp(_temperatureLow);
+                setHighTemp(_temperatureHigh);
+                enable |= HDC2080_STATUS_TEMPERATURE_LOW | HDC2080_STATUS_TEMPERATURE_HIGH;
+        }
+    }
+
+    if (_humidityBand != HDC2080_BAND_NONE)
+    {
+        float value = humidity();
+        _humidityBand = bandPosition(_humidityBand, value, _humidityLow, _humidityHigh, _humidityHysteresis);
+
+        switch (_humidityBand)
+        {
+            case HDC2080_BAND_ABOVE:
+
+                setLowHumidity(_humidityHigh - _humidityHysteresis);
+                enable |= HDC2080_STATUS_HUMIDITY_LOW;
+                break;
+
+            case HDC2080_BAND_BELOW:
+
+                setHighHumidity(_humidityLow + _humidityHysteresis);
+                enable |= HDC2080_STATUS_HUMIDITY_HIGH;
+                break;
+
+            default:
+
+                setLowHumidity(_humidityLow);
+                setHighHumidity(_humidityHigh);
+                enable |= HDC2080_STATUS_HUMIDITY_LOW | HDC2080_STATUS_HUMIDITY_HIGH;
+        }
+    }
+
+    // Interrupt enable bits match the status flags
+    uint8_t _content = readRegister8(_address, HDC2080_INTERRUPT_CONFIGURATION);
+    _content &= 0x87;
+    _content |= enable;
+    writeRegister8(_address, HDC2080_INTERRUPT_CONFIGURATION, _content);
+}
+
+void Sensor_HDC2080::beginThreshold(uint8_t interruptPin, uint8_t rate)
+{
+    _rate = rate;
+    setRate(rate);
+
+    // First values to position the bands
+    readInterruptStatus();
+    _status = 0;
+    triggerMeasurement();
+    waitDataReady();
+    readBurst(true);
+    armThresholds();
+
+    if (interruptPin > 0)
+    {
+        attachInterruptPin(interruptPin);
+    }
+}
+
+bool Sensor_HDC2080::waitDataReady()
+{
+    // Twice the conversion time as margin, in ms and rounded up
+    uint32_t timeout = 2 * ((conversionTime() + 999) / 1000);
+    uint32_t chrono = millis();
+
+    while ((readInterruptStatus() & HDC2080_STATUS_DATA_READY) == 0)
+    {
+        if (millis() - chrono > timeout)
+        {
+            return false;
+        }
+        delay(1);
+    }
+    return true;
+}
+
+uint8_t Sensor_HDC2080::event()
+{
+    if ((_interruptPin > 0) and not _pending)
+    {
+        return 0;
+    }
+    _pending = false;
+
+    readBurst(true);
+    uint8_t result = _status & HDC2080_STATUS_THRESHOLDS;
+    _status &= ~HDC2080_STATUS_THRESHOLDS;
+
+    if (result != 0)
+    {
+        armThresholds();
+        // Flags raised before re-arming are obsolete
+        readInterruptStatus();
+    }
+    return result;
+}
+
+uint8_t Sensor_HDC2080::temperatureBand()
+{
+    return _temperatureBand;
+}
+
+uint8_t Sensor_HDC2080::humidityBand()
+{
+    return _humidityBand;
+}
+
+// Resolution and timing
+// Table 7.5 Electrical Characteristics, conversion time in us
+// for 14, 11 and 9 bits
+static const uint16_t temperatureConversion[3] = { 610, 350, 225 };
+static const uint16_t humidityConversion[3] = { 660, 400, 275 };
+// Resolution = range / 2^bits, in °C and %
+static const float temperatureResolution[3] = { 165.0 / 16384.0, 165.0 / 2048.0, 165.0 / 512.0 };
+static const float humidityResolution[3] = { 100.0 / 16384.0, 100.0 / 2048.0, 100.0 / 512.0 };
+
+// Lowest resolution meeting the target
+static uint8_t resolutionFor(float target, const float * resolutions)
+{
+    for (uint8_t index = HDC2080_NINE_BIT; index > HDC2080_FOURTEEN_BIT; index--)
+    {
+        if (resolutions[index] <= target)
+        {
+            return index;
+        }
+    }
+    return HDC2080_FOURTEEN_BIT;
+}
+
+void Sensor_HDC2080::setAccuracy(float temperatureAccuracy, float humidityAccuracy)
+{
+    uint8_t _configuration = _measureConfiguration & 0x0f;
+
+    _configuration |= resolutionFor(temperatureAccuracy, temperatureResolution) << 6;
+    _configuration |= resolutionFor(humidityAccuracy, humidityResolution) << 4;
+
+    _measureConfiguration = _configuration;
+    writeRegister8(_address, HDC2080_MEASURE_CONFIGURATION, _configuration);
+}
+
+uint32_t Sensor_HDC2080::conversionTime()
+{
+    uint8_t temperatureBits = (_measureConfiguration >> 6) & 0x03;
+    uint8_t humidityBits = (_measureConfiguration >> 4) & 0x03;
+    uint8_t mode = (_measureConfiguration >> 1) & 0x03;
+    uint32_t result = 0;
+
+    temperatureBits = (temperatureBits > HDC2080_NINE_BIT) ? HDC2080_FOURTEEN_BIT : temperatureBits;
+    humidityBits = (humidityBits > HDC2080_NINE_BIT) ? HDC2080_FOURTEEN_BIT : humidityBits;
+
+    if (mode != HDC2080_HUMIDITY_ONLY)
+    {
+        result += temperatureConversion[temperatureBits];
+    }
+    if (mode != HDC2080_TEMPERATURE_ONLY)
+    {
+        result += humidityConversion[humidityBits];
+    }
+    return result;
+}
+
+uint8_t Sensor_HDC2080::measure()
+{
+    writeRegister8(_address, HDC2080_MEASURE_CONFIGURATION, _measureConfiguration | 0x01);
+
+    uint32_t period = conversionTime();
+    uint32_t chrono = micros();
+    while (micros() - chrono < period);
+
+    readBurst(false);
+    return (_status & HDC2080_STATUS_DATA_READY) ? HDC2080_FRESH : HDC2080_STALE;
+}
+
+// Offset adjustment
+// Table 8.6.9 and 8.6.10, two's complement, LSB = 165 / 2^10 °C and 100 / 2^9 %
+#define HDC2080_TEMPERATURE_OFFSET_LSB (165.0 / 1024.0)
+#define HDC2080_HUMIDITY_OFFSET_LSB (100.0 / 512.0)
+
+static uint8_t offsetRegister(float offset, float lsb)
+{
+    float steps = offset / lsb;
+    steps += (steps < 0) ? -0.5 : 0.5;
+
+    if (steps > 127.0)
+    {
+        steps = 127.0;
+    }
+    else if (steps < -128.0)
+    {
+        steps = -128.0;
+    }
+    return (uint8_t)(int8_t)steps;
+}
+
+bool Sensor_HDC2080::setTemperatureOffset(float offset)
+{
+    uint8_t _content = offsetRegister(offset, HDC2080_TEMPERATURE_OFFSET_LSB);
+
+    writeRegister8(_address, HDC2080_TEMPERATURE_OFFSET_ADJUST, _content);
+    return (readRegister8(_address, HDC2080_TEMPERATURE_OFFSET_ADJUST) == _content);
+}
+
+bool Sensor_HDC2080::setHumidityOffset(float offset)
+{
+    uint8_t _content = offsetRegister(offset, HDC2080_HUMIDITY_OFFSET_LSB);
+
+    writeRegister8(_address, HDC2080_HUMIDITY_OFFSET_ADJUST, _content);
+    return (readRegister8(_address, HDC2080_HUMIDITY_OFFSET_ADJUST) == _content);
+}
+
+float Sensor_HDC2080::temperatureOffset()
+{
+    int8_t _content = (int8_t)readRegister8(_address, HDC2080_TEMPERATURE_OFFSET_ADJUST);
+    return (float)_content * HDC2080_TEMPERATURE_OFFSET_LSB;
+}
+
+float Sensor_HDC2080::humidityOffset()
+{
+    int8_t _content = (int8_t)readRegister8(_address, HDC2080_HUMIDITY_OFFSET_ADJUST);
+    return (float)_content * HDC2080_HUMIDITY_OFFSET_LSB;
+}
@@ -27,6 +27,7 @@
 
 #include <Energia.h>
 #include <Wire.h>
+#include "Sensor_Device.h"
 
 ///
 /// @brief    Default address on LPSTK
@@ -72,10 +73,15 @@
 /// @brief    Measurement resolution
 /// @{
 #define HDC2080_FOURTEEN_BIT 0 ///< 14-bit
-#define HDC2080_ELEVEN_BIT 1 ///< 7-bit
+#define HDC2080_ELEVEN_BIT 1 ///< 11-bit
 #define HDC2080_NINE_BIT 2 ///< 9-bit
 /// @}
 
+///
+/// @brief    Accuracy target for the fastest conversion, see setAccuracy()
+///
+#define HDC2080_FASTEST 1000.0
+
 ///
 /// @brief    Sensor modes
 /// @{
@@ -101,6 +107,33 @@
 #define HDC2080_FIVE_HZ			7 ///< period = 0.2 second
 /// @}
 
+///
+/// @brief    Acquisition results
+/// @{
+#define HDC2080_FRESH 0 ///< new sample since the previous get()
+#define HDC2080_STALE 1 ///< no new sample, previous values kept
+/// @}
+
+///
+/// @brief    Status register flags
+/// @{
+#define HDC2080_STATUS_DATA_READY       0b10000000 ///< data ready
+#define HDC2080_STATUS_TEMPERATURE_HIGH 0b01000000 ///< temperature above high threshold
+#define HDC2080_STATUS_TEMPERATURE_LOW  0b00100000 ///< temperature below low threshold
+#define HDC2080_STATUS_HUMIDITY_HIGH    0b00010000 ///< humidity above high threshold
+#define HDC2080_STATUS_HUMIDITY_LOW     0b00001000 ///< humidity below low threshold
+#define HDC2080_STATUS_THRESHOLDS       0b01111000 ///< all the threshold flags
+/// @}
+
+///
+/// @brief    Position relative to a band
+/// @{
+#define HDC2080_BAND_NONE  0 ///< band not set
+#define HDC2080_BAND_IN    1 ///< within the band
+#define HDC2080_BAND_ABOVE 2 ///< above the band
+#define HDC2080_BAND_BELOW 3 ///< below the band
+/// @}
+
 
 ///
 /// @brief      Class for sensor HDC2080
@@ -124,10 +157,230 @@ class Sensor_HDC2080
     ///
     void begin(uint8_t configuration = HDC2080_DEFAULT_SETTINGS, uint8_t measure = HDC2080_MEASURE_SETTINGS);
 
+    ///
+    /// @brief    Initialisation, first step: configuration
+    /// @param    configuration default=HDC2080_DEFAULT_SETTINGS
+    /// @param    measure default=HDC2080_MEASURE_SETTINGS
+    /// @return   period to wait before beginConfigure(), ms
+    /// @note     For parallel initialisation with Sensor_Startup. begin() performs both steps.
+    ///
+    uint32_t beginReset(uint8_t configuration = HDC2080_DEFAULT_SETTINGS, uint8_t measure = HDC2080_MEASURE_SETTINGS);
+
+    ///
+    /// @brief    Initialisation, second step: first conversion
+    /// @return   period to wait before the first get(), ms
+    ///
+    uint32_t beginConfigure();
+
+    ///
+    /// @brief    Initialisation, warm resume
+    /// @param    configuration default=HDC2080_DEFAULT_SETTINGS
+    /// @param    measure default=HDC2080_MEASURE_SETTINGS
+    /// @return   true if resumed without rewriting the configuration, false if begin() was performed
+    /// @note     Device identity and configuration registers are read back and compared
+    /// @n        with the requested configuration. The rewrite is skipped on match.
+    ///
+    bool beginResume(uint8_t configuration = HDC2080_DEFAULT_SETTINGS, uint8_t measure = HDC2080_MEASURE_SETTINGS);
+
+    ///
+    /// @brief	Who Am I?
+    /// @return	name of the sensor, string
+    ///
+#if (SENSOR_HEAP_FREE == 1)
+    const char * WhoAmI();
+#else
+    String WhoAmI();
+#endif
+
+    ///
+    /// @brief	Device type
+    /// @return	device identifier, SENSOR_DEVICE_HDC2080
+    ///
+    sensor_device_e deviceType();
+
+    ///
+    /// @brief    Set resolutions from accuracy targets
+    /// @param    temperatureAccuracy target, in °C, default=HDC2080_FASTEST
+    /// @param    humidityAccuracy target, in %, default=HDC2080_FASTEST
+    /// @note     The lowest resolution with a step below the target is selected:
+    /// Resolution | Temperature | Humidity
+    /// ---- | ---- | ----
+    /// 14 bits | 0.010 °C, 610 us | 0.006 %, 660 us
+    /// 11 bits | 0.081 °C, 350 us | 0.049 %, 400 us
+    /// 9 bits | 0.322 °C, 225 us | 0.195 %, 275 us
+    ///
+    void setAccuracy(float temperatureAccuracy = HDC2080_FASTEST, float humidityAccuracy = HDC2080_FASTEST);
+
+    ///
+    /// @brief    Program temperature offset
+    /// @param    offset offset added by the HDC2080 to the temperature, in °C, -20.62..+20.46
+    /// @return   true if the register read back matches, false otherwise
+    /// @note     The offset is quantised to 165 / 1024 = 0.16 °C, two's complement.
+    /// @n        The compensated value comes straight from the sensor, with no CPU cost per sample.
+    ///
+    bool setTemperatureOffset(float offset);
+
+    ///
+    /// @brief    Program humidity offset
+    /// @param    offset offset added by the HDC2080 to the relative humidity, in %, -25.0..+24.8
+    /// @return   true if the register read back matches, false otherwise
+    /// @note     The offset is quantised to 100 / 512 = 0.20 %, two's complement.
+    ///
+    bool setHumidityOffset(float offset);
+
+    ///
+    /// @brief    Read temperature offset
+    /// @return   offset programmed in the HDC2080, in °C
+    ///
+    float temperatureOffset();
+
+    ///
+    /// @brief    Read humidity offset
+    /// @return   offset programmed in the HDC2080, in %
+    ///
+    float humidityOffset();
+
+    ///
+    /// @brief    Conversion time
+    /// @return   Conversion time for the current resolutions and measurement mode, in us
+    ///
+    uint32_t conversionTime();
+
+    ///
+    /// @brief    Triggered acquisition
+    /// @details  Trigger a measurement, wait for conversionTime() and read the values
+    /// @return   HDC2080_FRESH, HDC2080_STALE if the conversion is not complete
+    /// @note     For manual mode only
+    ///
+    uint8_t measure();
+
+    ///
+    /// @brief    Initialisation of the acquisition on data ready interrupt
+    /// @param    interruptPin pin connected to the DRDY/INT output of the HDC2080
+    /// @param    rate default=HDC2080_MANUAL, otherwise auto-measurement period HDC2080_TWO_MINUTES..HDC2080_FIVE_HZ
+    /// @note     Call after begin(). The output is set to active high, level sensitive.
+    /// @n        The first measurement is triggered immediately.
+    /// @n        With HDC2080_MANUAL, a new measurement is triggered after each fresh get().
+    /// @note     Only one HDC2080 can use the data ready interrupt.
+    ///
+    void beginDataReady(uint8_t interruptPin, uint8_t rate = HDC2080_MANUAL);
+
+    ///
+    /// @brief    Stop the acquisition on data ready interrupt
+    ///
+    void endDataReady();
+
+    ///
+    /// @brief    Check for new sample
+    /// @return   true if a new sample is ready, set by the interrupt
+    /// @note     Always true without beginDataReady()
+    ///
+    bool available();
+
     ///
     /// @brief    Acquisition
+    /// @param    withMaximum default=false=temperature, humidity and status,
+    ///           true=also maximum registers, in the same transaction
+    /// @return   HDC2080_FRESH if a conversion completed since the last read of the status, HDC2080_STALE otherwise
+    /// @note     Temperature and humidity are read in a single burst, so they come from the same conversion.
+    /// @n        2 transactions and 8 bytes, against 4 transactions and 10 bytes with one read per register.
+    /// @note     Reading the status register clears its flags. Threshold flags are kept for event().
+    /// @note     With beginDataReady(), get() returns HDC2080_STALE immediately, without bus traffic,
+    ///           if no sample is available.
+    ///
+    uint8_t get(bool withMaximum = false);
+
+    ///
+    /// @brief    Initialisation of the autonomous acquisition
+    /// @param    rate auto-measurement period, HDC2080_TWO_MINUTES..HDC2080_FIVE_HZ
+    /// @note     The HDC2080 samples on its own and tracks the maximum values,
+    ///           the MCU can sleep for many periods and call harvest() on wake-up.
+    /// @note     The rate alone does not start the HDC2080, the first measurement is triggered here.
     ///
-    void get();
+    void beginAutoMeasurement(uint8_t rate);
+
+    ///
+    /// @brief    Harvest latest and maximum values, then clear the maximum registers
+    /// @return   HDC2080_FRESH if at least one conversion completed since the previous harvest, HDC2080_STALE otherwise
+    /// @note     One burst read of 0x00..0x06 and one write of 0x05..0x06.
+    ///
+    uint8_t harvest();
+
+    ///
+    /// @brief    Set temperature band for threshold events
+    /// @param    low lower limit, in °C
+    /// @param    high upper limit, in °C
+    /// @param    hysteresis margin to come back into the band, in °C, default=1.0
+    /// @note     Thresholds have 8-bit resolution, 0.64 °C, rounded outwards: the band is never narrower.
+    ///
+    void setTemperatureBand(float low, float high, float hysteresis = 1.0);
+
+    ///
+    /// @brief    Set humidity band for threshold events
+    /// @param    low lower limit, in %
+    /// @param    high upper limit, in %
+    /// @param    hysteresis margin to come back into the band, in %, default=2.0
+    /// @note     Thresholds have 8-bit resolution, 0.39 %, rounded outwards: the band is never narrower.
+    ///
+    void setHumidityBand(float low, float high, float hysteresis = 2.0);
+
+    ///
+    /// @brief    Initialisation of the threshold events
+    /// @param    interruptPin pin connected to the DRDY/INT output, 0=none and event() polls the sensor
+    /// @param    rate auto-measurement period, HDC2080_TWO_MINUTES..HDC2080_FIVE_HZ
+    /// @note     Call after setTemperatureBand() and/or setHumidityBand().
+    /// @n        Blocks until the first conversion is ready, twice conversionTime() at most.
+    /// @n        The thresholds are armed around the current values, so only a transition raises an event:
+    ///           leaving the band, then coming back into it beyond the hysteresis.
+    ///
+    void beginThreshold(uint8_t interruptPin, uint8_t rate);
+
+    ///
+    /// @brief    Service threshold events
+    /// @return   0 if no event, otherwise HDC2080_STATUS_TEMPERATURE_HIGH..HDC2080_STATUS_HUMIDITY_LOW flags
+    /// @note     Without pending interrupt, returns 0 immediately without bus traffic.
+    /// @n        On event, values are updated and the thresholds re-armed around them.
+    /// @code
+    ///    if (myHDC2080.event())
+    ///    {
+    ///        if (myHDC2080.temperatureBand() != HDC2080_BAND_IN) ...
+    ///    }
+    /// @endcode
+    ///
+    uint8_t event();
+
+    ///
+    /// @brief    Temperature position
+    /// @return   HDC2080_BAND_NONE, HDC2080_BAND_IN, HDC2080_BAND_ABOVE or HDC2080_BAND_BELOW
+    ///
+    uint8_t temperatureBand();
+
+    ///
+    /// @brief    Humidity position
+    /// @return   HDC2080_BAND_NONE, HDC2080_BAND_IN, HDC2080_BAND_ABOVE or HDC2080_BAND_BELOW
+    ///
+    uint8_t humidityBand();
+
+    ///
+    /// @brief    Status
+    /// @return   Interrupt and data ready status, as read by the last get(), measure() or harvest()
+    /// @note     Threshold flags are kept until event().
+    ///
+    uint8_t status();
+
+    ///
+    /// @brief    Maximum temperature
+    /// @return   Maximum temperature in °K, as read by the last get(true) or harvest()
+    /// @note     The register has 8-bit resolution. When the latest sample is the maximum, its 14-bit value is returned.
+    ///
+    float maxTemperature();
+
+    ///
+    /// @brief    Maximum humidity
+    /// @return   Maximum relative humidity in %, as read by the last get(true) or harvest()
+    /// @note     The register has 8-bit resolution. When the latest sample is the maximum, its 14-bit value is returned.
+    ///
+    float maxHumidity();
 
     ///
     /// @brief    Measure
@@ -140,7 +393,19 @@ class Sensor_HDC2080
     /// @return   Relative humidity in %
     ///
     double humidity();
-    
+
+    ///
+    /// @brief    Raw measure
+    /// @return   Temperature register, 1 LSB = 165 / 2^16 °C from -40 °C
+    ///
+    uint16_t rawTemperature();
+
+    ///
+    /// @brief    Raw measure
+    /// @return   Humidity register, 1 LSB = 100 / 2^16 %
+    ///
+    uint16_t rawHumidity();
+
     ///
     /// @brief    Manage power
     /// @param    mode LOW=default=off, HIGH=on
@@ -217,7 +482,31 @@ class Sensor_HDC2080
     int _address; 									// Address of sensor
     uint16_t _humidity;
     uint16_t _temperature;
+    uint8_t _status;
+    uint8_t _maxTemperature;
+    uint8_t _maxHumidity;
     float rangeCheck(float value, float minValue, float maxValue);
+    void readBurst(bool withMaximum);
+    void attachInterruptPin(uint8_t interruptPin);
+    void armThresholds();
+    bool waitDataReady();
+
+    uint8_t _measureConfiguration;
+    uint8_t _interruptPin;
+    uint8_t _rate;
+    bool _dataReady;
+    volatile bool _pending;
+
+    float _temperatureLow;
+    float _temperatureHigh;
+    float _temperatureHysteresis;
+    uint8_t _temperatureBand;
+    float _humidityLow;
+    float _humidityHigh;
+    float _humidityHysteresis;
+    uint8_t _humidityBand;
+    static Sensor_HDC2080 * _interruptInstance;
+    static void _interruptISR();
 };
 
 
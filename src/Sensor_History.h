@@ -0,0 +1,316 @@
+///
+/// @file		Sensor_History.h
+/// @brief		Library header
+/// @details	Timestamped ring buffer of samples, lock-free
+/// @n
+/// @n @b		Project SensorsBoosterPack
+/// @n @a		Developed with [embedXcode+](https://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		https://embeddedcomputing.weebly.com
+///
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2015-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+///
+
+#ifndef Sensor_History_RELEASE
+///
+/// @brief	Release
+///
+#define Sensor_History_RELEASE 101
+
+
+// Include core library - IDE-based
+#if defined(WIRING) // Wiring specific
+#include "Wiring.h"
+#elif defined(MAPLE_IDE) // Maple specific
+#include "WProgram.h"
+#elif defined(ROBOTIS) // Robotis specific
+#include "libpandora_types.h"
+#include "pandora.h"
+#elif defined(MPIDE) // chipKIT specific
+#include "WProgram.h"
+#elif defined(DIGISPARK) // Digispark specific
+#include "Arduino.h"
+#elif defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#elif defined(LITTLEROBOTFRIENDS) // LittleRobotFriends specific
+#include "LRF.h"
+#elif defined(MICRODUINO) // Microduino specific
+#include "Arduino.h"
+#elif defined(TEENSYDUINO) // Teensy specific
+#include "Arduino.h"
+#elif defined(REDBEARLAB) // RedBearLab specific
+#include "Arduino.h"
+#elif defined(RFDUINO) // RFduino specific
+#include "Arduino.h"
+#elif defined(SPARK) // Spark specific
+#include "application.h"
+#elif defined(ARDUINO) // Arduino 1.0 and 1.5 specific
+#include "Arduino.h"
+#else // error
+#   error Platform not defined
+#endif // end IDE
+
+#if defined(SENSOR_HOST)
+#include <atomic>
+#endif
+
+///
+/// @brief	    Policies when the buffer is full
+/// @{
+#define HISTORY_OVERWRITE_OLDEST 0 ///< the new sample replaces the oldest one
+#define HISTORY_DROP_NEWEST 1 ///< the new sample is dropped
+/// @}
+
+///
+/// @cond
+///
+#if defined(SENSOR_HOST)
+// Host threads may run on several cores: full memory fence
+#define HISTORY_BARRIER() std::atomic_thread_fence(std::memory_order_seq_cst)
+#else
+// Compiler barrier: single-core MCU, only the compiler may reorder accesses
+#define HISTORY_BARRIER() __asm__ __volatile__("" ::: "memory")
+#endif
+///
+/// @endcond
+///
+
+///
+/// @brief      Timestamped sample
+/// @details    value is a scaled integer, e.g. raw() of a channel: value() = value * resolution + offset
+///
+template <typename myValue>
+struct history_sample_s
+{
+    uint32_t timestamp; ///< ms
+    myValue value; ///< scaled integer
+};
+
+///
+/// @brief      Ring buffer of timestamped samples for one channel
+/// @details    Statically allocated, size is a power of two.
+/// @n          push() and pop() are O(1), first() is O(log size).
+/// @note       One producer, possibly an ISR, and one consumer, without locks.
+/// @n          Indexes run freely and only the producer writes the head, only the consumer the tail.
+/// @n          With HISTORY_OVERWRITE_OLDEST, the consumer detects the samples overwritten under it.
+/// @n          first() and peek() use the same free-running indexes, valid while the sample is in the buffer.
+/// @note       On a host, define SENSOR_HOST for threads on several cores.
+/// @code
+///    Sensor_History<64> myLightHistory; // 64 x 8 bytes
+///    myLightHistory.push(myOPT3001Adapter.raw(0), millis());
+///    ...
+///    history_sample_s<int16_t> sample;
+///    for (uint16_t index = myLightHistory.first(millis() - 10000); myLightHistory.peek(index, sample); index++) ...
+/// @endcode
+///
+template <uint16_t size, typename myValue = int16_t>
+class Sensor_History
+{
+    // size must be a power of two
+    typedef char _checkSize[(size > 0) and ((size & (size - 1)) == 0) ? 1 : -1];
+
+  public:
+    ///
+    /// @brief	Constructor
+    /// @param	policy default=HISTORY_OVERWRITE_OLDEST, HISTORY_DROP_NEWEST
+    ///
+    Sensor_History(uint8_t policy = HISTORY_OVERWRITE_OLDEST)
+    {
+        _policy = policy;
+        _head = 0;
+        _tail = 0;
+        _dropped = 0;
+        _overwritten = 0;
+    }
+
+    ///
+    /// @brief	Add a sample, producer side
+    /// @param	value scaled integer
+    /// @param	timestamp ms
+    /// @return	false if dropped
+    ///
+    bool push(myValue value, uint32_t timestamp)
+    {
+        uint16_t head = _head;
+        if ((_policy == HISTORY_DROP_NEWEST) and ((uint16_t)(head - _tail) >= size))
+        {
+            _dropped++;
+            return false;
+        }
+
+        _samples[head & (size - 1)].timestamp = timestamp;
+        _samples[head & (size - 1)].value = value;
+
+        // Sample complete before it becomes visible
+        HISTORY_BARRIER();
+        _head = head + 1;
+        return true;
+    }
+
+    ///
+    /// @brief	Remove the oldest sample, consumer side
+    /// @param	sample oldest sample
+    /// @return	false if empty
+    ///
+    bool pop(history_sample_s<myValue> & sample)
+    {
+        while (true)
+        {
+            uint16_t tail = oldest();
+            if (tail == _head)
+            {
+                return false;
+            }
+
+            if (copy(tail, sample))
+            {
+                _tail = tail + 1;
+                return true;
+            }
+        }
+    }
+
+    ///
+    /// @brief	Read a sample without removing it, consumer side
+    /// @param	index free-running index, from first()
+    /// @param	sample sample
+    /// @return	false if index is beyond the newest sample or already overwritten
+    ///
+    bool peek(uint16_t index, history_sample_s<myValue> & sample)
+    {
+        while (true)
+        {
+            uint16_t tail = oldest();
+            if ((uint16_t)(index - tail) >= (uint16_t)(_head - tail))
+            {
+                return false;
+            }
+
+            if (copy(index, sample))
+            {
+                return true;
+            }
+        }
+    }
+
+    ///
+    /// @brief	First sample of a time window, consumer side
+    /// @param	start beginning of the window, ms
+    /// @return	free-running index for peek() of the oldest sample at or after start,
+    ///         index after the newest sample if none
+    /// @note   Timestamps are expected in chronological order, wrap-safe.
+    /// @n      The search restarts if the producer overwrites a sample under it.
+    ///
+    uint16_t first(uint32_t start)
+    {
+        history_sample_s<myValue> sample;
+        bool valid = false;
+        uint16_t low = 0;
+
+        while (not valid)
+        {
+            low = oldest();
+            uint16_t high = _head;
+            valid = true;
+
+            // Binary search of the first timestamp not before start
+            while (valid and (low != high))
+            {
+                uint16_t middle = low + (uint16_t)(high - low) / 2;
+                valid = copy(middle, sample);
+                if ((int32_t)(sample.timestamp - start) < 0)
+                {
+                    low = middle + 1;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+        }
+        return low;
+    }
+
+    ///
+    /// @brief	Number of samples, consumer side
+    /// @return	number of samples available
+    ///
+    uint16_t available()
+    {
+        return _head - oldest();
+    }
+
+    ///
+    /// @brief	Capacity
+    /// @return	maximum number of samples
+    /// @note   size - 1 with HISTORY_OVERWRITE_OLDEST, as the slot being written is not readable.
+    ///
+    uint16_t capacity()
+    {
+        return (_policy == HISTORY_OVERWRITE_OLDEST) ? size - 1 : size;
+    }
+
+    ///
+    /// @brief	Number of samples lost
+    /// @return	samples dropped by push() or overwritten before being read
+    /// @note   Overwritten samples are counted by the consumer, exact if it polls within every 65536 samples.
+    ///
+    uint32_t lost()
+    {
+        return _dropped + _overwritten;
+    }
+
+    ///
+    /// @brief	Remove all the samples, consumer side
+    ///
+    void clear()
+    {
+        _tail = (uint16_t)_head;
+    }
+
+  private:
+    // Oldest sample still in the buffer, samples overwritten are skipped
+    uint16_t oldest()
+    {
+        uint16_t tail = _tail;
+        uint16_t count = _head - tail;
+        if (count > capacity())
+        {
+            _overwritten += count - capacity();
+            tail += count - capacity();
+            _tail = tail;
+        }
+        return tail;
+    }
+
+    // Copy, then check the producer has not overwritten the sample meanwhile
+    bool copy(uint16_t index, history_sample_s<myValue> & sample)
+    {
+        sample.timestamp = _samples[index & (size - 1)].timestamp;
+        sample.value = _samples[index & (size - 1)].value;
+        HISTORY_BARRIER();
+        return ((uint16_t)(_head - index) <= capacity());
+    }
+
+    history_sample_s<myValue> _samples[size];
+#if defined(SENSOR_HOST)
+    std::atomic<uint16_t> _head; ///< written by the producer only
+    std::atomic<uint16_t> _tail; ///< written by the consumer only
+    std::atomic<uint32_t> _dropped; ///< written by the producer only
+#else
+    volatile uint16_t _head; ///< written by the producer only
+    volatile uint16_t _tail; ///< written by the consumer only
+    volatile uint32_t _dropped; ///< written by the producer only
+#endif
+    uint32_t _overwritten; ///< written by the consumer only
+    uint8_t _policy;
+};
+
+#endif
@@ -0,0 +1,63 @@
+//
+// Sensor_Interface.cpp
+// Library C++ code
+// ----------------------------------
+// Developed with embedXcode+
+// https://embedXcode.weebly.com
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// See 			Sensor_Interface.h and ReadMe.txt for references
+//
+
+
+// Include library header
+#include "Sensor_Interface.h"
+
+// Channels, resolution and offset as in the conversion of each driver
+const sensor_channel_s Sensor_Traits<Sensor_TMP007>::_channels[2] =
+{
+    { "internal", &KELVIN, 1.0 / 32.0, 273.15 },
+    { "external", &KELVIN, 1.0 / 32.0, 273.15 },
+};
+
+const sensor_channel_s Sensor_Traits<Sensor_TMP116>::_channels[1] =
+{
+    { "temperature", &KELVIN, 1.0 / 128.0, 273.15 },
+};
+
+const sensor_channel_s Sensor_Traits<Sensor_HDC1000>::_channels[2] =
+{
+    { "temperature", &KELVIN, 160.0 / 65536.0, 233.15 },
+    { "humidity", &PERCENT, 100.0 / 65536.0, 0.0 },
+};
+
+const sensor_channel_s Sensor_Traits<Sensor_HDC2080>::_channels[2] =
+{
+    { "temperature", &KELVIN, 165.0 / 65536.0, 233.15 },
+    { "humidity", &PERCENT, 100.0 / 65536.0, 0.0 },
+};
+
+const sensor_channel_s Sensor_Traits<Sensor_OPT3001>::_channels[1] =
+{
+    { "light", &LUX, 0.01, 0.0 },
+};
+
+const sensor_channel_s Sensor_Traits<Sensor_BMP280>::_channels[2] =
+{
+    { "temperature", &KELVIN, 1.0 / 5120.0, 273.15 },
+    { "pressure", &HECTOPASCAL, 1.0 / 25600.0, 0.0 },
+};
+
+const sensor_channel_s Sensor_Traits<Sensor_BME280>::_channels[3] =
+{
+    { "temperature", &KELVIN, 1.0 / 5120.0, 273.15 },
+    { "pressure", &HECTOPASCAL, 1.0 / 25600.0, 0.0 },
+    { "humidity", &PERCENT, 1.0 / 1024.0, 0.0 },
+};
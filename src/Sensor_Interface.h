@@ -0,0 +1,349 @@
+///
+/// @file		Sensor_Interface.h
+/// @brief		Library header
+/// @details	Common interface for all the sensors
+/// @n
+/// @n @b		Project SensorsBoosterPack
+/// @n @a		Developed with [embedXcode+](https://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		https://embeddedcomputing.weebly.com
+///
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2015-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+///
+
+#ifndef Sensor_Interface_RELEASE
+///
+/// @brief	Release
+///
+#define Sensor_Interface_RELEASE 101
+
+
+// Include core library - IDE-based
+#if defined(WIRING) // Wiring specific
+#include "Wiring.h"
+#elif defined(MAPLE_IDE) // Maple specific
+#include "WProgram.h"
+#elif defined(ROBOTIS) // Robotis specific
+#include "libpandora_types.h"
+#include "pandora.h"
+#elif defined(MPIDE) // chipKIT specific
+#include "WProgram.h"
+#elif defined(DIGISPARK) // Digispark specific
+#include "Arduino.h"
+#elif defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#elif defined(LITTLEROBOTFRIENDS) // LittleRobotFriends specific
+#include "LRF.h"
+#elif defined(MICRODUINO) // Microduino specific
+#include "Arduino.h"
+#elif defined(TEENSYDUINO) // Teensy specific
+#include "Arduino.h"
+#elif defined(REDBEARLAB) // RedBearLab specific
+#include "Arduino.h"
+#elif defined(RFDUINO) // RFduino specific
+#include "Arduino.h"
+#elif defined(SPARK) // Spark specific
+#include "application.h"
+#elif defined(ARDUINO) // Arduino 1.0 and 1.5 specific
+#include "Arduino.h"
+#else // error
+#   error Platform not defined
+#endif // end IDE
+
+#include "Sensor_Device.h"
+#include "Sensor_Units.h"
+#include "Sensor_TMP007.h"
+#include "Sensor_TMP116.h"
+#include "Sensor_HDC1000.h"
+#include "Sensor_HDC2080.h"
+#include "Sensor_OPT3001.h"
+#include "Sensor_BMP280.h"
+#include "Sensor_BME280.h"
+
+///
+/// @brief	    Acquisition results, common to all sensors
+/// @{
+#define SENSOR_FRESH 0 ///< new measurement
+#define SENSOR_STALE 1 ///< no new measurement, previous values kept
+#define SENSOR_ERROR 2 ///< invalid measurement
+/// @}
+
+///
+/// @brief      Channel descriptor
+/// @details    value() = raw() * resolution + offset, in unit
+///
+struct sensor_channel_s
+{
+    const char * name; ///< quantity, e.g. "temperature"
+    const unit_conversion_s * unit; ///< unit of value()
+    float resolution; ///< value of 1 LSB of raw(), in unit
+    float offset; ///< value for raw() = 0, in unit
+};
+
+///
+/// @brief      Sensor traits, zero-overhead interface
+/// @details    One specialisation per driver maps its methods to a common set of static functions:
+/// * deviceType(sensor)
+/// * channels() and channel(index), channel descriptors
+/// * trigger(sensor), start a conversion if the sensor is not converting on its own, without waiting
+/// * acquire(sensor), read the last conversion without waiting, SENSOR_FRESH, SENSOR_STALE or SENSOR_ERROR
+/// * value(sensor, index), converted value of a channel, in channel(index)->unit
+/// * raw(sensor, index), integer value of a channel as computed by the driver, in channel(index)->resolution
+/// * conversionTime(sensor), duration of one conversion in µs
+/// * setPowerMode(sensor, mode)
+/// @n          Generic code written as a template on the driver type is resolved at compile time.
+/// @code
+///    template <typename mySensor>
+///    void logSensor(mySensor & sensor)
+///    {
+///        typedef Sensor_Traits<mySensor> traits;
+///        if (traits::acquire(sensor) == SENSOR_FRESH)
+///        {
+///            for (uint8_t index = 0; index < traits::channels(); index++)
+///            {
+///                Serial.print(traits::value(sensor, index));
+///            }
+///        }
+///    }
+/// @endcode
+///
+template <typename mySensor>
+struct Sensor_Traits;
+
+///
+/// @cond
+///
+#define SENSOR_TRAITS_CHANNELS(count) \
+    static const sensor_channel_s _channels[count]; \
+    static uint8_t channels() { return count; } \
+    static const sensor_channel_s * channel(uint8_t index) { return &_channels[index]; }
+///
+/// @endcond
+///
+
+template <>
+struct Sensor_Traits<Sensor_TMP007>
+{
+    SENSOR_TRAITS_CHANNELS(2)
+    static sensor_device_e deviceType(Sensor_TMP007 & sensor) { return sensor.deviceType(); }
+    // Continuous conversions, nothing to start
+    static void trigger(Sensor_TMP007 &) { }
+    static uint8_t acquire(Sensor_TMP007 & sensor)
+    {
+        uint8_t result = sensor.get();
+        return (result == TMP007_INVALID) ? SENSOR_ERROR : result;
+    }
+    static float value(Sensor_TMP007 & sensor, uint8_t index) { return (index == 0) ? sensor.internal() : sensor.external(); }
+    static int32_t raw(Sensor_TMP007 & sensor, uint8_t index) { return (index == 0) ? sensor.rawInternal() : sensor.rawExternal(); }
+    static uint32_t conversionTime(Sensor_TMP007 & sensor) { return sensor.conversionTime() * 1000; }
+    static void setPowerMode(Sensor_TMP007 & sensor, uint8_t mode) { sensor.setPowerMode(mode); }
+};
+
+template <>
+struct Sensor_Traits<Sensor_TMP116>
+{
+    SENSOR_TRAITS_CHANNELS(1)
+    static sensor_device_e deviceType(Sensor_TMP116 & sensor) { return sensor.deviceType(); }
+    // One-shot write, nothing in continuous mode
+    static void trigger(Sensor_TMP116 & sensor) { sensor.triggerMeasurement(); }
+    static uint8_t acquire(Sensor_TMP116 & sensor) { return sensor.readMeasurement(); }
+    static float value(Sensor_TMP116 & sensor, uint8_t) { return sensor.temperature(); }
+    static int32_t raw(Sensor_TMP116 & sensor, uint8_t) { return sensor.rawTemperature(); }
+    static uint32_t conversionTime(Sensor_TMP116 & sensor) { return sensor.conversionTime() * 1000; }
+    static void setPowerMode(Sensor_TMP116 & sensor, uint8_t mode) { sensor.setPowerMode(mode); }
+};
+
+template <>
+struct Sensor_Traits<Sensor_HDC1000>
+{
+    SENSOR_TRAITS_CHANNELS(2)
+    static sensor_device_e deviceType(Sensor_HDC1000 & sensor) { return sensor.deviceType(); }
+    // Pointer write to 0x00
+    static void trigger(Sensor_HDC1000 & sensor) { sensor.triggerMeasurement(); }
+    static uint8_t acquire(Sensor_HDC1000 & sensor) { return (sensor.readMeasurement() == HDC1000_FRESH) ? SENSOR_FRESH : SENSOR_STALE; }
+    static float value(Sensor_HDC1000 & sensor, uint8_t index) { return (index == 0) ? sensor.temperature() : sensor.humidity(); }
+    static int32_t raw(Sensor_HDC1000 & sensor, uint8_t index) { return (index == 0) ? sensor.rawTemperature() : sensor.rawHumidity(); }
+    static uint32_t conversionTime(Sensor_HDC1000 & sensor) { return sensor.conversionTime(); }
+    static void setPowerMode(Sensor_HDC1000 & sensor, uint8_t mode) { sensor.setPowerMode(mode); }
+};
+
+template <>
+struct Sensor_Traits<Sensor_HDC2080>
+{
+    SENSOR_TRAITS_CHANNELS(2)
+    static sensor_device_e deviceType(Sensor_HDC2080 & sensor) { return sensor.deviceType(); }
+    static void trigger(Sensor_HDC2080 & sensor) { sensor.triggerMeasurement(); }
+    static uint8_t acquire(Sensor_HDC2080 & sensor) { return sensor.get(); }
+    static float value(Sensor_HDC2080 & sensor, uint8_t index) { return (index == 0) ? sensor.temperature() : sensor.humidity(); }
+    static int32_t raw(Sensor_HDC2080 & sensor, uint8_t index) { return (index == 0) ? sensor.rawTemperature() : sensor.rawHumidity(); }
+    static uint32_t conversionTime(Sensor_HDC2080 & sensor) { return sensor.conversionTime(); }
+    static void setPowerMode(Sensor_HDC2080 & sensor, uint8_t mode) { sensor.setPowerMode(mode); }
+};
+
+template <>
+struct Sensor_Traits<Sensor_OPT3001>
+{
+    SENSOR_TRAITS_CHANNELS(1)
+    static sensor_device_e deviceType(Sensor_OPT3001 & sensor) { return sensor.deviceType(); }
+    // Single-shot write, nothing in continuous mode
+    static void trigger(Sensor_OPT3001 & sensor) { sensor.triggerMeasurement(); }
+    static uint8_t acquire(Sensor_OPT3001 & sensor)
+    {
+        uint8_t result = sensor.get(false);
+        return (result == OPT3001_FRESH) ? SENSOR_FRESH : ((result == OPT3001_STALE) ? SENSOR_STALE : SENSOR_ERROR);
+    }
+    static float value(Sensor_OPT3001 & sensor, uint8_t) { return sensor.light(); }
+    static int32_t raw(Sensor_OPT3001 & sensor, uint8_t) { return (int32_t)sensor.rawLight(); }
+    static uint32_t conversionTime(Sensor_OPT3001 & sensor) { return sensor.conversionTime() * 1000; }
+    static void setPowerMode(Sensor_OPT3001 & sensor, uint8_t mode) { sensor.setPowerMode(mode); }
+};
+
+template <>
+struct Sensor_Traits<Sensor_BMP280>
+{
+    SENSOR_TRAITS_CHANNELS(2)
+    static sensor_device_e deviceType(Sensor_BMP280 & sensor) { return sensor.deviceType(); }
+    // Forced-mode write, nothing in normal mode
+    static void trigger(Sensor_BMP280 & sensor) { sensor.triggerMeasurement(); }
+    static uint8_t acquire(Sensor_BMP280 & sensor)
+    {
+        uint8_t result = sensor.readMeasurement();
+        return (result == BMP280_SUCCESS) ? SENSOR_FRESH : ((result == BMP280_STALE) ? SENSOR_STALE : SENSOR_ERROR);
+    }
+    static float value(Sensor_BMP280 & sensor, uint8_t index) { return (index == 0) ? sensor.temperature() : sensor.pressure(); }
+    static int32_t raw(Sensor_BMP280 & sensor, uint8_t index) { return (index == 0) ? sensor.rawTemperature() : sensor.rawPressure(); }
+    static uint32_t conversionTime(Sensor_BMP280 & sensor) { return sensor.conversionTime(); }
+    static void setPowerMode(Sensor_BMP280 & sensor, uint8_t mode) { sensor.setPowerMode(mode); }
+};
+
+template <>
+struct Sensor_Traits<Sensor_BME280>
+{
+    SENSOR_TRAITS_CHANNELS(3)
+    static sensor_device_e deviceType(Sensor_BME280 & sensor) { return sensor.deviceType(); }
+    // Forced-mode write
+    static void trigger(Sensor_BME280 & sensor) { sensor.triggerMeasurement(); }
+    static uint8_t acquire(Sensor_BME280 & sensor)
+    {
+        uint8_t result = sensor.readMeasurement();
+        return (result == BME280_SUCCESS) ? SENSOR_FRESH : ((result == BME280_STALE) ? SENSOR_STALE : SENSOR_ERROR);
+    }
+    static float value(Sensor_BME280 & sensor, uint8_t index)
+    {
+        return (index == 0) ? sensor.temperature() : ((index == 1) ? sensor.pressure() : sensor.humidity());
+    }
+    static int32_t raw(Sensor_BME280 & sensor, uint8_t index)
+    {
+        return (index == 0) ? sensor.rawTemperature() : ((index == 1) ? sensor.rawPressure() : sensor.rawHumidity());
+    }
+    static uint32_t conversionTime(Sensor_BME280 & sensor) { return sensor.conversionTime(); }
+    static void setPowerMode(Sensor_BME280 & sensor, uint8_t mode) { sensor.setPowerMode(mode); }
+};
+
+///
+/// @brief      Common interface, virtual
+/// @details    For code that handles sensors of different types at run-time, e.g. an array of sensors.
+/// @note       Costs one virtual call per function. Use Sensor_Adapter to build one.
+///
+class Sensor_Interface
+{
+  public:
+    ///
+    /// @brief	Device type
+    /// @return	device identifier
+    ///
+    virtual sensor_device_e deviceType() = 0;
+
+    ///
+    /// @brief	Number of channels
+    /// @return	number of channels
+    ///
+    virtual uint8_t channels() = 0;
+
+    ///
+    /// @brief	Channel descriptor
+    /// @param	index channel, 0..channels() - 1
+    /// @return	name, unit, resolution and offset of the channel
+    ///
+    virtual const sensor_channel_s * channel(uint8_t index) = 0;
+
+    ///
+    /// @brief	Start a conversion, without waiting
+    /// @note   Does nothing for sensors converting on their own: TMP007,
+    ///         TMP116 and OPT3001 in continuous mode, BMP280 in normal mode.
+    ///
+    virtual void trigger() = 0;
+
+    ///
+    /// @brief	Acquisition
+    /// @return	SENSOR_FRESH, SENSOR_STALE or SENSOR_ERROR
+    /// @note   Only reads the last conversion, allow conversionTime() after trigger().
+    ///
+    virtual uint8_t acquire() = 0;
+
+    ///
+    /// @brief	Converted value
+    /// @param	index channel, 0..channels() - 1
+    /// @return	value, in channel(index)->unit
+    ///
+    virtual float value(uint8_t index) = 0;
+
+    ///
+    /// @brief	Integer value
+    /// @param	index channel, 0..channels() - 1
+    /// @return	value, in LSB of channel(index)->resolution
+    ///
+    virtual int32_t raw(uint8_t index) = 0;
+
+    ///
+    /// @brief	Conversion time
+    /// @return	duration of one conversion, in µs
+    ///
+    virtual uint32_t conversionTime() = 0;
+
+    ///
+    /// @brief	Manage power
+    /// @param	mode LOW=off, HIGH=on
+    ///
+    virtual void setPowerMode(uint8_t mode) = 0;
+};
+
+///
+/// @brief      Adapter from a driver to Sensor_Interface
+/// @code
+///    Sensor_Adapter<Sensor_TMP116> myTMP116Adapter(myTMP116);
+///    Sensor_Interface * mySensors[] = { &myTMP116Adapter, &myOPT3001Adapter };
+/// @endcode
+///
+template <typename mySensor>
+class Sensor_Adapter : public Sensor_Interface
+{
+  public:
+    ///
+    /// @brief	Constructor
+    /// @param	sensor driver, already initialised by its own begin()
+    ///
+    Sensor_Adapter(mySensor & sensor) : _sensor(sensor) { }
+
+    sensor_device_e deviceType() { return Sensor_Traits<mySensor>::deviceType(_sensor); }
+    uint8_t channels() { return Sensor_Traits<mySensor>::channels(); }
+    const sensor_channel_s * channel(uint8_t index) { return Sensor_Traits<mySensor>::channel(index); }
+    void trigger() { Sensor_Traits<mySensor>::trigger(_sensor); }
+    uint8_t acquire() { return Sensor_Traits<mySensor>::acquire(_sensor); }
+    float value(uint8_t index) { return Sensor_Traits<mySensor>::value(_sensor, index); }
+    int32_t raw(uint8_t index) { return Sensor_Traits<mySensor>::raw(_sensor, index); }
+    uint32_t conversionTime() { return Sensor_Traits<mySensor>::conversionTime(_sensor); }
+    void setPowerMode(uint8_t mode) { Sensor_Traits<mySensor>::setPowerMode(_sensor, mode); }
+
+  private:
+    mySensor & _sensor;
+};
+
+#endif
@@ -34,6 +34,10 @@
 #define OPT3001_DEVICE_ID_REGISTER      0x7f
 
 #define OPT3001_READY_FLAG              0x80
+#define OPT3001_OVERFLOW_FLAG           0x0100
+#define OPT3001_MODE_MASK               0x0600
+#define OPT3001_MODE_SINGLE_SHOT        0x0200
+#define OPT3001_CONVERSION_800_MS       0x0800
 //#define OPT3001_POWER_UP                0x0400
 
 
@@ -41,13 +45,24 @@
 Sensor_OPT3001::Sensor_OPT3001(uint8_t address)
 {
     _address = address;
+    _calibration = NULL;
+    _rawLux = 0;
 }
 
+#if (SENSOR_HEAP_FREE == 1)
+const char * Sensor_OPT3001::WhoAmI()
+#else
 String Sensor_OPT3001::WhoAmI()
+#endif
 {
     return "OPT3001 luxmeter";
 }
 
+sensor_device_e Sensor_OPT3001::deviceType()
+{
+    return SENSOR_DEVICE_OPT3001;
+}
+
 void Sensor_OPT3001::begin(uint16_t configuration, uint8_t interruptPin)
 {
     _configuration = configuration;
@@ -83,26 +98,64 @@ void Sensor_OPT3001::begin(uint16_t configuration, uint8_t interruptPin)
     }
 */
 
-void Sensor_OPT3001::get()
+void Sensor_OPT3001::setCalibration(Calibration_Table * table)
+{
+    _calibration = table;
+}
+
+uint32_t Sensor_OPT3001::conversionTime()
+{
+    return (_configuration & OPT3001_CONVERSION_800_MS) ? 800 : 100;
+}
+
+void Sensor_OPT3001::triggerMeasurement()
+{
+    // Continuous mode converts on its own, single-shot mode converts once per write
+    if ((_configuration & OPT3001_MODE_MASK) == OPT3001_MODE_SINGLE_SHOT)
+    {
+        writeRegister16(_address, OPT3001_CONFIGURATION_REGISTER, _configuration);
+    }
+}
+
+uint8_t Sensor_OPT3001::get(bool wait)
 {
-    uint16_t count = 0x0fff;
+    if (wait)
+    {
+        triggerMeasurement();
+    }
 
-    while (((readRegister16(_address, OPT3001_CONFIGURATION_REGISTER) & OPT3001_READY_FLAG) == 0x00) and (count > 0))
+    uint16_t count = wait ? 0x0fff : 0;
+    uint16_t configurationRegister = readRegister16(_address, OPT3001_CONFIGURATION_REGISTER);
+
+    while (((configurationRegister & OPT3001_READY_FLAG) == 0x00) and (count > 0))
     {
         delayBusy(30);
         count--;
+        configurationRegister = readRegister16(_address, OPT3001_CONFIGURATION_REGISTER);
     }
 
-    if (count > 0)
+    if ((configurationRegister & OPT3001_READY_FLAG) == 0x00)
+    {
+        return OPT3001_STALE;
+    }
+    if (configurationRegister & OPT3001_OVERFLOW_FLAG)
     {
-        _rawLux = readRegister16(_address, OPT3001_RESULT_REGISTER);
+        return OPT3001_ERROR;
+    }
+
+    uint16_t resultRegister = readRegister16(_address, OPT3001_RESULT_REGISTER);
 
-        // Extract _fraction and _exponent from _rawLux data
-        uint32_t _fraction = _rawLux & 0x0fff;
-        uint32_t _exponent = 1 << ((_rawLux >> 12) & 0x000f);
+    // Extract _fraction and _exponent from the result register
+    uint32_t _fraction = resultRegister & 0x0fff;
+    uint32_t _exponent = 1 << ((resultRegister >> 12) & 0x000f);
 
-        _rawLux = (_fraction * _exponent);
+    _rawLux = (_fraction * _exponent);
+    if (_calibration != NULL)
+    {
+        int32_t value = _calibration->apply((int32_t)_rawLux);
+        _rawLux = (value > 0) ? (uint32_t)value : 0;
     }
+    return OPT3001_FRESH;
 }
 
 //uint32_t Sensor_OPT3001::light()
@@ -112,6 +165,11 @@ float Sensor_OPT3001::light()
     return 0.01 * (float)_rawLux;
 }
 
+uint32_t Sensor_OPT3001::rawLight()
+{
+    return _rawLux;
+}
+
 void Sensor_OPT3001::setPowerMode(uint8_t mode)
 {
     //    uint16_t statusMaskRegister = readRegister16(TMP007_SLAVE_ADDRESS, TMP007_STATUS_MASK);
@@ -53,6 +53,8 @@
 #endif // end IDE
 
 #include "Wire.h"
+#include "Sensor_Device.h"
+#include "Sensor_Calibration.h"
 
 #ifndef Sensor_OPT3001_RELEASE
 ///
@@ -71,6 +73,14 @@
 #define OPT3001_800_MS_CONTINUOUS  0xcc10 ///< continuous
 /// @}
 
+///
+/// @brief      get() results
+/// @{
+#define OPT3001_FRESH               0 ///< new measurement
+#define OPT3001_STALE               1 ///< conversion not ready, previous value kept
+#define OPT3001_ERROR               2 ///< overflow, previous value kept
+/// @}
+
 ///
 /// @brief      Interrupt pin number
 ///
@@ -106,12 +116,48 @@ class Sensor_OPT3001
     /// @brief	Who Am I?
     /// @return	name of the sensor, string
     ///
+#if (SENSOR_HEAP_FREE == 1)
+    const char * WhoAmI();
+#else
     String WhoAmI();
+#endif
+
+    ///
+    /// @brief	Device type
+    /// @return	device identifier, SENSOR_DEVICE_OPT3001
+    ///
+    sensor_device_e deviceType();
 
     ///
     /// @brief	Acquisition
+    /// @param	wait default=true=wait for the conversion-ready flag,
+    /// @n      false=return OPT3001_STALE if the conversion is not ready
+    /// @return	OPT3001_FRESH, OPT3001_STALE or OPT3001_ERROR
+    /// @note   Reading the configuration register clears the conversion-ready flag,
+    ///         so each conversion is returned as fresh only once.
+    /// @n      With wait=true, triggerMeasurement() is performed first.
+    ///
+    uint8_t get(bool wait = true);
+
     ///
-    void get();
+    /// @brief	Start a conversion, without waiting
+    /// @note   In single-shot mode, writes the configuration register.
+    /// @n      In continuous mode, does nothing as the OPT3001 converts on its own.
+    ///
+    void triggerMeasurement();
+
+    ///
+    /// @brief	Attach a software calibration
+    /// @param	table calibration table, NULL = none
+    /// @note   Integer unit of the table: 0.01 lux
+    ///
+    void setCalibration(Calibration_Table * table);
+
+    ///
+    /// @brief	Conversion time
+    /// @return	duration in ms of one conversion, 100 or 800 ms as set by begin()
+    ///
+    uint32_t conversionTime();
 
     ///
     /// @brief	Measure
@@ -120,6 +166,12 @@ class Sensor_OPT3001
     float light();
     // uint32_t light();
 
+    ///
+    /// @brief	Raw measure
+    /// @return	light after software calibration, 1 LSB = 0.01 lux
+    ///
+    uint32_t rawLight();
+
     ///
     /// @brief	Manage power
     /// @param	mode LOW=default=off, HIGH=on
@@ -140,6 +192,7 @@ class Sensor_OPT3001
     //	uint16_t config_reg;/**< configuration register setting*/
     //	uint16_t lowlimit_reg;/**< low limit register value*/
     //	uint16_t highlimit_reg;/**< high limit register value*/
+    Calibration_Table * _calibration;
     uint8_t _interruptPin;
     uint16_t _configuration;
     uint32_t _rawLux; ///< raw lux result register value
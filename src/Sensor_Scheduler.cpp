@@ -0,0 +1,197 @@
+//
+// Sensor_Scheduler.cpp
+// Library C++ code
+// ----------------------------------
+// Developed with embedXcode+
+// https://embedXcode.weebly.com
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// See 			Sensor_Scheduler.h and ReadMe.txt for references
+//
+
+
+// Include library header
+#include "Sensor_Scheduler.h"
+
+// Wrap-safe a < b
+static bool before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+// Code
+Sensor_Scheduler::Sensor_Scheduler()
+{
+    _count = 0;
+}
+
+uint8_t Sensor_Scheduler::add(Sensor_Interface * sensor, uint32_t period)
+{
+    // µs to ms, rounded up
+    return add(sensor, period, (sensor->conversionTime() + 999) / 1000);
+}
+
+uint8_t Sensor_Scheduler::add(Sensor_Interface * sensor, uint32_t period, uint32_t latency)
+{
+    if (_count >= SCHEDULER_TASKS)
+    {
+        return SCHEDULER_NONE;
+    }
+
+    uint8_t task = _count;
+    _tasks[task].sensor = sensor;
+    _tasks[task].period = period;
+    _tasks[task].latency = (latency < period) ? latency : period;
+    _tasks[task].time = millis();
+    _tasks[task].deadline = _tasks[task].time + _tasks[task].latency;
+    _tasks[task].triggered = false;
+    _tasks[task].result = SENSOR_STALE;
+
+    _heap[_count] = task;
+    _count++;
+    siftUp(_count - 1);
+    return task;
+}
+
+void Sensor_Scheduler::begin()
+{
+    begin(millis());
+}
+
+void Sensor_Scheduler::begin(uint32_t now)
+{
+    for (uint8_t task = 0; task < _count; task++)
+    {
+        _tasks[task].time = now;
+        _tasks[task].deadline = now + _tasks[task].latency;
+        _tasks[task].triggered = false;
+        _heap[task] = task;
+    }
+    // Same time for all, already a heap
+}
+
+uint32_t Sensor_Scheduler::next()
+{
+    return (_count > 0) ? _tasks[_heap[0]].time : millis();
+}
+
+uint8_t Sensor_Scheduler::service(uint32_t now)
+{
+    if ((_count == 0) or before(now, _tasks[_heap[0]].time))
+    {
+        return SCHEDULER_NONE;
+    }
+
+    uint8_t task = _heap[0];
+    task_s * current = &_tasks[task];
+    uint8_t result = SCHEDULER_NONE;
+
+    if (not current->triggered)
+    {
+        current->sensor->trigger();
+        current->triggered = true;
+        current->time = current->deadline;
+    }
+    else
+    {
+        current->result = current->sensor->acquire();
+        result = task;
+
+        current->deadline += current->period;
+        // Overrun, skip the missed periods
+        while (before(current->deadline, now + current->latency))
+        {
+            current->deadline += current->period;
+        }
+        current->triggered = false;
+        current->time = current->deadline - current->latency;
+    }
+
+    // Only the root has changed
+    siftDown(0);
+    return result;
+}
+
+uint8_t Sensor_Scheduler::run()
+{
+    uint8_t result = SCHEDULER_NONE;
+
+    while ((_count > 0) and (result == SCHEDULER_NONE))
+    {
+        uint32_t now = millis();
+        uint32_t time = next();
+        if (before(now, time))
+        {
+            delay(time - now);
+        }
+        result = service(millis());
+    }
+    return result;
+}
+
+Sensor_Interface * Sensor_Scheduler::sensor(uint8_t task)
+{
+    return _tasks[task].sensor;
+}
+
+uint8_t Sensor_Scheduler::result(uint8_t task)
+{
+    return _tasks[task].result;
+}
+
+bool Sensor_Scheduler::earlier(uint8_t heapA, uint8_t heapB)
+{
+    return before(_tasks[_heap[heapA]].time, _tasks[_heap[heapB]].time);
+}
+
+void Sensor_Scheduler::siftDown(uint8_t index)
+{
+    while (true)
+    {
+        uint8_t smallest = index;
+        uint8_t left = 2 * index + 1;
+        uint8_t right = left + 1;
+
+        if ((left < _count) and earlier(left, smallest))
+        {
+            smallest = left;
+        }
+        if ((right < _count) and earlier(right, smallest))
+        {
+            smallest = right;
+        }
+        if (smallest == index)
+        {
+            return;
+        }
+
+        uint8_t swap = _heap[index];
+        _heap[index] = _heap[smallest];
+        _heap[smallest] = swap;
+        index = smallest;
+    }
+}
+
+void Sensor_Scheduler::siftUp(uint8_t index)
+{
+    while (index > 0)
+    {
+        uint8_t parent = (index - 1) / 2;
+        if (not earlier(index, parent))
+        {
+            return;
+        }
+
+        uint8_t swap = _heap[index];
+        _heap[index] = _heap[parent];
+        _heap[parent] = swap;
+        index = parent;
+    }
+}
@@ -0,0 +1,180 @@
+///
+/// @file		Sensor_Scheduler.h
+/// @brief		Library header
+/// @details	Multi-rate acquisition scheduler with a deadline queue
+/// @n
+/// @n @b		Project SensorsBoosterPack
+/// @n @a		Developed with [embedXcode+](https://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		https://embeddedcomputing.weebly.com
+///
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2015-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+///
+
+#ifndef Sensor_Scheduler_RELEASE
+///
+/// @brief	Release
+///
+#define Sensor_Scheduler_RELEASE 101
+
+
+// Include core library - IDE-based
+#if defined(WIRING) // Wiring specific
+#include "Wiring.h"
+#elif defined(MAPLE_IDE) // Maple specific
+#include "WProgram.h"
+#elif defined(ROBOTIS) // Robotis specific
+#include "libpandora_types.h"
+#include "pandora.h"
+#elif defined(MPIDE) // chipKIT specific
+#include "WProgram.h"
+#elif defined(DIGISPARK) // Digispark specific
+#include "Arduino.h"
+#elif defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#elif defined(LITTLEROBOTFRIENDS) // LittleRobotFriends specific
+#include "LRF.h"
+#elif defined(MICRODUINO) // Microduino specific
+#include "Arduino.h"
+#elif defined(TEENSYDUINO) // Teensy specific
+#include "Arduino.h"
+#elif defined(REDBEARLAB) // RedBearLab specific
+#include "Arduino.h"
+#elif defined(RFDUINO) // RFduino specific
+#include "Arduino.h"
+#elif defined(SPARK) // Spark specific
+#include "application.h"
+#elif defined(ARDUINO) // Arduino 1.0 and 1.5 specific
+#include "Arduino.h"
+#else // error
+#   error Platform not defined
+#endif // end IDE
+
+#include "Sensor_Interface.h"
+
+///
+/// @brief      Maximum number of tasks
+///
+#define SCHEDULER_TASKS 8
+
+///
+/// @brief      No task
+///
+#define SCHEDULER_NONE 0xff
+
+///
+/// @brief      Multi-rate acquisition scheduler
+/// @details    Each task acquires one sensor at its own period.
+/// @n          The conversion is triggered latency ms before the deadline, so the result is ready at the deadline.
+/// @n          Events are kept in a min-heap on their time: next() is O(1), service() is O(log n).
+/// @note       No dynamic allocation. Times are millis(), wrap-safe.
+/// @code
+///    Sensor_Adapter<Sensor_OPT3001> myOPT3001Adapter(myOPT3001);
+///    myScheduler.add(&myOPT3001Adapter, 100);
+///    myScheduler.begin();
+///    ...
+///    uint8_t task = myScheduler.run();
+/// @endcode
+///
+class Sensor_Scheduler
+{
+  public:
+    ///
+    /// @brief	Constructor
+    ///
+    Sensor_Scheduler();
+
+    ///
+    /// @brief	Add a task, latency from the conversion time of the sensor
+    /// @param	sensor sensor, already initialised
+    /// @param	period period between two acquisitions, ms
+    /// @return	task index, SCHEDULER_NONE if full
+    ///
+    uint8_t add(Sensor_Interface * sensor, uint32_t period);
+
+    ///
+    /// @brief	Add a task
+    /// @param	sensor sensor, already initialised
+    /// @param	period period between two acquisitions, ms
+    /// @param	latency delay between trigger and acquisition, ms
+    /// @return	task index, SCHEDULER_NONE if full
+    ///
+    uint8_t add(Sensor_Interface * sensor, uint32_t period, uint32_t latency);
+
+    ///
+    /// @brief	Start all the tasks
+    /// @param	now current time, ms
+    /// @note   The first conversions are triggered at once.
+    /// @n      A task added later starts when added.
+    ///
+    void begin(uint32_t now);
+
+    ///
+    /// @brief	Start all the tasks, now
+    ///
+    void begin();
+
+    ///
+    /// @brief	Time of the next event
+    /// @return	time, ms
+    ///
+    uint32_t next();
+
+    ///
+    /// @brief	Service the next event if due
+    /// @param	now current time, ms
+    /// @return	index of the task acquired, SCHEDULER_NONE if no acquisition
+    /// @note   Acquisitions missed by more than one period are skipped, the tasks keep their time grid.
+    ///
+    uint8_t service(uint32_t now);
+
+    ///
+    /// @brief	Wait for the next acquisition and perform it
+    /// @return	index of the task acquired, SCHEDULER_NONE if no task
+    /// @note   Waits with delay(), which puts the MCU into low-power mode on Energia.
+    ///
+    uint8_t run();
+
+    ///
+    /// @brief	Sensor of a task
+    /// @param	task task index
+    /// @return	sensor
+    ///
+    Sensor_Interface * sensor(uint8_t task);
+
+    ///
+    /// @brief	Result of the last acquisition of a task
+    /// @param	task task index
+    /// @return	SENSOR_FRESH, SENSOR_STALE or SENSOR_ERROR
+    ///
+    uint8_t result(uint8_t task);
+
+  private:
+    struct task_s
+    {
+        Sensor_Interface * sensor;
+        uint32_t period;
+        uint32_t latency;
+        uint32_t deadline; ///< next acquisition
+        uint32_t time; ///< next event, trigger or acquisition
+        bool triggered;
+        uint8_t result;
+    };
+
+    void siftDown(uint8_t index);
+    void siftUp(uint8_t index);
+    bool earlier(uint8_t heapA, uint8_t heapB);
+
+    task_s _tasks[SCHEDULER_TASKS];
+    uint8_t _heap[SCHEDULER_TASKS]; ///< task indexes, ordered on time
+    uint8_t _count;
+};
+
+#endif
@@ -0,0 +1,116 @@
+//
+// Sensor_Snapshot.cpp
+// Library C++ code
+// ----------------------------------
+// Developed with embedXcode+
+// https://embedXcode.weebly.com
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// See 			Sensor_Snapshot.h and ReadMe.txt for references
+//
+
+
+// Include library header
+#include "Sensor_Snapshot.h"
+
+#if defined(SENSOR_HOST)
+// Host threads may run on several cores: full memory fence
+#define SNAPSHOT_BARRIER() std::atomic_thread_fence(std::memory_order_seq_cst)
+#else
+// Compiler barrier: single-core MCU, only the compiler may reorder accesses
+#define SNAPSHOT_BARRIER() __asm__ __volatile__("" ::: "memory")
+#endif
+
+// Code
+Sensor_Snapshot::Sensor_Snapshot()
+{
+    memset(_buffers, 0, sizeof(_buffers));
+    _sequence = 0;
+    _editing = false;
+}
+
+sensor_snapshot_s * Sensor_Snapshot::edit()
+{
+    uint8_t front = _sequence & 1;
+    sensor_snapshot_s * back = &_buffers[front ^ 1];
+
+    // Back buffer is two publications old, start from the front one
+    if (not _editing)
+    {
+        memcpy(back, &_buffers[front], sizeof(sensor_snapshot_s));
+        _editing = true;
+    }
+    return back;
+}
+
+uint8_t Sensor_Snapshot::update(uint8_t first, Sensor_Interface * sensor, uint8_t result, uint32_t now)
+{
+    sensor_snapshot_s * snapshot = edit();
+    uint8_t index = first;
+
+    for (uint8_t channel = 0; (channel < sensor->channels()) and (index < SNAPSHOT_CHANNELS); channel++)
+    {
+        snapshot_channel_s * current = &snapshot->channels[index];
+        current->result = result;
+        if (result == SENSOR_FRESH)
+        {
+            current->value = sensor->value(channel);
+            current->raw = sensor->raw(channel);
+            current->timestamp = now;
+        }
+        index++;
+    }
+
+    if (snapshot->count < index)
+    {
+        snapshot->count = index;
+    }
+    return index;
+}
+
+void Sensor_Snapshot::publish()
+{
+    publish(millis());
+}
+
+void Sensor_Snapshot::publish(uint32_t now)
+{
+    edit()->timestamp = now;
+
+    // Back buffer complete before it becomes the front one
+    SNAPSHOT_BARRIER();
+    _sequence = _sequence + 1;
+    // Next edit() of the old front buffer after the publication
+    SNAPSHOT_BARRIER();
+    _editing = false;
+}
+
+bool Sensor_Snapshot::read(sensor_snapshot_s & snapshot)
+{
+    for (uint8_t retry = 0; retry < SNAPSHOT_RETRIES; retry++)
+    {
+        uint8_t sequence = _sequence;
+        SNAPSHOT_BARRIER();
+        memcpy(&snapshot, &_buffers[sequence & 1], sizeof(sensor_snapshot_s));
+        SNAPSHOT_BARRIER();
+
+        // The writer only edits the front buffer after a publication
+        if (_sequence == sequence)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t Sensor_Snapshot::sequence()
+{
+    return _sequence;
+}
@@ -0,0 +1,176 @@
+///
+/// @file		Sensor_Snapshot.h
+/// @brief		Library header
+/// @details	Coherent snapshot of all the channels, double-buffered
+/// @n
+/// @n @b		Project SensorsBoosterPack
+/// @n @a		Developed with [embedXcode+](https://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		https://embeddedcomputing.weebly.com
+///
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2015-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+///
+
+#ifndef Sensor_Snapshot_RELEASE
+///
+/// @brief	Release
+///
+#define Sensor_Snapshot_RELEASE 101
+
+
+// Include core library - IDE-based
+#if defined(WIRING) // Wiring specific
+#include "Wiring.h"
+#elif defined(MAPLE_IDE) // Maple specific
+#include "WProgram.h"
+#elif defined(ROBOTIS) // Robotis specific
+#include "libpandora_types.h"
+#include "pandora.h"
+#elif defined(MPIDE) // chipKIT specific
+#include "WProgram.h"
+#elif defined(DIGISPARK) // Digispark specific
+#include "Arduino.h"
+#elif defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#elif defined(LITTLEROBOTFRIENDS) // LittleRobotFriends specific
+#include "LRF.h"
+#elif defined(MICRODUINO) // Microduino specific
+#include "Arduino.h"
+#elif defined(TEENSYDUINO) // Teensy specific
+#include "Arduino.h"
+#elif defined(REDBEARLAB) // RedBearLab specific
+#include "Arduino.h"
+#elif defined(RFDUINO) // RFduino specific
+#include "Arduino.h"
+#elif defined(SPARK) // Spark specific
+#include "application.h"
+#elif defined(ARDUINO) // Arduino 1.0 and 1.5 specific
+#include "Arduino.h"
+#else // error
+#   error Platform not defined
+#endif // end IDE
+
+#include "Sensor_Interface.h"
+
+#if defined(SENSOR_HOST)
+#include <atomic>
+#endif
+
+///
+/// @brief      Maximum number of channels in a snapshot
+///
+#define SNAPSHOT_CHANNELS 12
+
+///
+/// @brief      Maximum number of attempts of read()
+///
+#define SNAPSHOT_RETRIES 4
+
+///
+/// @brief      Channel in a snapshot
+///
+struct snapshot_channel_s
+{
+    float value; ///< converted value, in the unit of the channel
+    int32_t raw; ///< integer value, in LSB of the channel
+    uint32_t timestamp; ///< ms, last fresh acquisition
+    uint8_t result; ///< SENSOR_FRESH, SENSOR_STALE or SENSOR_ERROR
+};
+
+///
+/// @brief      Snapshot of all the channels
+///
+struct sensor_snapshot_s
+{
+    uint32_t timestamp; ///< ms, publication
+    uint8_t count; ///< number of channels used
+    snapshot_channel_s channels[SNAPSHOT_CHANNELS];
+};
+
+///
+/// @brief      Coherent multi-sensor snapshot
+/// @details    The acquisition side edits the back buffer and publishes it at once.
+/// @n          Readers copy the front buffer and check the sequence number has not changed meanwhile,
+/// @n          so a snapshot is never torn across channels. Neither side blocks the other.
+/// @note       One writer, any number of readers, including ISRs.
+/// @n          A reader interrupted by more than one publication retries, up to SNAPSHOT_RETRIES times.
+/// @note       On the MCU, a compiler barrier is enough. On a host, define SENSOR_HOST
+///             for threads on several cores: std::atomic sequence and memory fences.
+/// @code
+///    uint8_t task = myScheduler.run();
+///    mySnapshot.update(first[task], myScheduler.sensor(task), myScheduler.result(task), millis());
+///    mySnapshot.publish();
+///    ...
+///    sensor_snapshot_s snapshot;
+///    if (mySnapshot.read(snapshot)) ...
+/// @endcode
+///
+class Sensor_Snapshot
+{
+  public:
+    ///
+    /// @brief	Constructor
+    ///
+    Sensor_Snapshot();
+
+    ///
+    /// @brief	Back buffer, writer side
+    /// @return	snapshot to edit, initialised with the last published one
+    /// @note   Changes are visible to readers after publish() only.
+    ///
+    sensor_snapshot_s * edit();
+
+    ///
+    /// @brief	Copy the channels of a sensor into the back buffer, writer side
+    /// @param	first index of the first channel of the sensor in the snapshot
+    /// @param	sensor sensor, already acquired
+    /// @param	result result of the acquisition, SENSOR_FRESH, SENSOR_STALE or SENSOR_ERROR
+    /// @param	now time of the acquisition, ms
+    /// @return	index of the channel after the last one of the sensor
+    /// @note   Values and timestamps are only updated for SENSOR_FRESH.
+    ///
+    uint8_t update(uint8_t first, Sensor_Interface * sensor, uint8_t result, uint32_t now);
+
+    ///
+    /// @brief	Publish the back buffer, writer side
+    /// @param	now time of the publication, ms
+    ///
+    void publish(uint32_t now);
+
+    ///
+    /// @brief	Publish the back buffer now, writer side
+    ///
+    void publish();
+
+    ///
+    /// @brief	Copy the last published snapshot, reader side
+    /// @param	snapshot copy
+    /// @return	true if the copy is coherent, false after SNAPSHOT_RETRIES attempts
+    ///
+    bool read(sensor_snapshot_s & snapshot);
+
+    ///
+    /// @brief	Number of publications
+    /// @return	sequence number, modulo 256
+    /// @note   Readers can poll it to detect a new snapshot.
+    ///
+    uint8_t sequence();
+
+  private:
+    sensor_snapshot_s _buffers[2]; ///< front is _buffers[_sequence & 1]
+#if defined(SENSOR_HOST)
+    std::atomic<uint8_t> _sequence; ///< host threads may run on several cores
+#else
+    volatile uint8_t _sequence;
+#endif
+    bool _editing;
+};
+
+#endif
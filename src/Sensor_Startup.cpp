@@ -0,0 +1,69 @@
+//
+// Sensor_Startup.cpp
+// Library C++ code
+// ----------------------------------
+// Developed with embedXcode+
+// https://embedXcode.weebly.com
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// See 			Sensor_Startup.h and ReadMe.txt for references
+//
+
+
+// Include library header
+#include "Sensor_Startup.h"
+
+// Code
+Sensor_Startup::Sensor_Startup()
+{
+    _start = 0;
+    _deadline = 0;
+    _pending = false;
+    _started = false;
+}
+
+void Sensor_Startup::after(uint32_t period)
+{
+    uint32_t now = millis();
+    if (not _started)
+    {
+        _start = now;
+        _started = true;
+    }
+
+    // Wrap-safe latest deadline
+    uint32_t deadline = now + period;
+    if ((not _pending) or ((int32_t)(deadline - _deadline) > 0))
+    {
+        _deadline = deadline;
+    }
+    _pending = true;
+}
+
+uint32_t Sensor_Startup::wait()
+{
+    uint32_t result = 0;
+    if (_pending)
+    {
+        uint32_t now = millis();
+        if ((int32_t)(_deadline - now) > 0)
+        {
+            result = _deadline - now;
+            delay(result);
+        }
+        _pending = false;
+    }
+    return result;
+}
+
+uint32_t Sensor_Startup::elapsed()
+{
+    return _started ? millis() - _start : 0;
+}
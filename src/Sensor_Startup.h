@@ -0,0 +1,109 @@
+///
+/// @file		Sensor_Startup.h
+/// @brief		Library header
+/// @details	Parallel initialisation of the sensors
+/// @n
+/// @n @b		Project SensorsBoosterPack
+/// @n @a		Developed with [embedXcode+](https://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		https://embeddedcomputing.weebly.com
+///
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2015-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+///
+
+#ifndef Sensor_Startup_RELEASE
+///
+/// @brief	Release
+///
+#define Sensor_Startup_RELEASE 101
+
+
+// Include core library - IDE-based
+#if defined(WIRING) // Wiring specific
+#include "Wiring.h"
+#elif defined(MAPLE_IDE) // Maple specific
+#include "WProgram.h"
+#elif defined(ROBOTIS) // Robotis specific
+#include "libpandora_types.h"
+#include "pandora.h"
+#elif defined(MPIDE) // chipKIT specific
+#include "WProgram.h"
+#elif defined(DIGISPARK) // Digispark specific
+#include "Arduino.h"
+#elif defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#elif defined(LITTLEROBOTFRIENDS) // LittleRobotFriends specific
+#include "LRF.h"
+#elif defined(MICRODUINO) // Microduino specific
+#include "Arduino.h"
+#elif defined(TEENSYDUINO) // Teensy specific
+#include "Arduino.h"
+#elif defined(REDBEARLAB) // RedBearLab specific
+#include "Arduino.h"
+#elif defined(RFDUINO) // RFduino specific
+#include "Arduino.h"
+#elif defined(SPARK) // Spark specific
+#include "application.h"
+#elif defined(ARDUINO) // Arduino 1.0 and 1.5 specific
+#include "Arduino.h"
+#else // error
+#   error Platform not defined
+#endif // end IDE
+
+///
+/// @brief      Parallel initialisation
+/// @details    Keeps the latest deadline of the steps issued, so a single wait covers all the sensors.
+/// @n          Each step is issued to all the sensors, then wait() waits for the slowest one only.
+/// @code
+///    Sensor_Startup myStartup;
+///    myStartup.after(myBME280.beginReset());
+///    myStartup.after(myTMP007.beginReset(TMP007_FOUR_SAMPLES));
+///    myStartup.wait();
+///    myStartup.after(myBME280.beginConfigure());
+///    myStartup.after(myTMP007.beginConfigure());
+///    myStartup.wait();
+///    myBME280.get();
+///    myTMP007.get();
+/// @endcode
+///
+class Sensor_Startup
+{
+  public:
+    ///
+    /// @brief	Constructor
+    ///
+    Sensor_Startup();
+
+    ///
+    /// @brief	Register a period to wait for
+    /// @param	period period from now, ms, as returned by the begin steps
+    ///
+    void after(uint32_t period);
+
+    ///
+    /// @brief	Wait for the latest deadline
+    /// @return	period actually waited, ms
+    ///
+    uint32_t wait();
+
+    ///
+    /// @brief	Total duration of the initialisation
+    /// @return	time since the first after(), ms
+    ///
+    uint32_t elapsed();
+
+  private:
+    uint32_t _start;
+    uint32_t _deadline;
+    bool _pending;
+    bool _started;
+};
+
+#endif
@@ -35,62 +35,181 @@
 //#define TMP007_POWER_DOWN               0x0000
 #define TMP007_POWER_UP                 0x1000
 #define TMP007_READY                    0x4000
+#define TMP007_DEVICE_ID_VALUE          0x0078
 
 #define TMP007_CONVERSION_DONE          0x0080
+#define TMP007_DATA_INVALID             0x0200
+#define TMP007_SAMPLES_MASK             0x0E00
 
 
 // Code
 Sensor_TMP007::Sensor_TMP007(uint8_t address)
 {
     _address = address;
+    _calibration = NULL;
+    _totalSamples = TMP007_FOUR_SAMPLES;
+    _internalTemperature = 0.0;
+    _externalTemperature = 0.0;
+    _rawExternal = 0;
+    _chrono = 0;
+    _raw.voltage = 0;
+    _raw.internal = 0;
+    _raw.external = 0;
+    _raw.status = 0;
 }
 
 void Sensor_TMP007::begin(uint16_t totalSamples)
 {
+    beginReset(totalSamples);
+    beginConfigure();
+    get(true);
+}
+
+uint32_t Sensor_TMP007::beginReset(uint16_t totalSamples)
+{
+    _totalSamples = totalSamples & TMP007_SAMPLES_MASK;
     writeRegister16(_address, TMP007_CONFIGURATION, TMP007_RESET);
-    writeRegister16(_address, TMP007_CONFIGURATION, TMP007_POWER_UP | totalSamples);
-    //    writeRegister16(_address, TMP007_STATUS_MASK, TMP007_READY);
-    delay(100);
-    get();
-    delay(100);
+    return 0;
 }
 
-void Sensor_TMP007::get()
+uint32_t Sensor_TMP007::beginConfigure()
 {
-    int16_t _rawTemperature;
+    writeRegister16(_address, TMP007_CONFIGURATION, TMP007_POWER_UP | _totalSamples);
+    writeRegister16(_address, TMP007_STATUS_MASK, TMP007_READY);
+    _chrono = millis();
+    return conversionTime();
+}
 
-    _rawTemperature = readRegister16(_address, TMP007_INTERNAL_TEMPERATURE);
-    // .03125 = 1 / 32
-    _internalTemperature = (float)(_rawTemperature >> 2) * .03125 + 273.15;
-
-    //    Serial.print("?=\t");
-    //    Serial.print(readRegister16(_address, TMP007_STATUS), BIN);
-    //    Serial.print("\t");
-    //    Serial.print(readRegister16(_address, TMP007_CONFIGURATION), BIN);
-    //    Serial.print("\t");
-    //    Serial.print("\tb0=");
-    //    Serial.print(_rawTemperature, BIN);
-    //    Serial.print("\tb0&=");
-    //    Serial.print(((_rawTemperature & 0b1) == 0), DEC);
-    //    Serial.print("\t");
-
-    _rawTemperature = readRegister16(_address, TMP007_EXTERNAL_TEMPERATURE);
-    // Check validity in bit 0
-    if ((_rawTemperature & 0b1) == 0)
+bool Sensor_TMP007::beginResume(uint16_t totalSamples)
+{
+    totalSamples &= TMP007_SAMPLES_MASK;
+
+    const uint8_t commands[3] = { TMP007_CONFIGURATION, TMP007_STATUS_MASK, TMP007_DEVICE_ID };
+    uint16_t values[3];
+    readRegisters16(_address, commands, values, 3);
+
+    // Alert and conversion flags excluded
+    uint16_t configuration = values[0] & (TMP007_RESET | TMP007_POWER_UP | TMP007_SAMPLES_MASK | TMP007_ALERT_ENABLE);
+    if ((configuration != (TMP007_POWER_UP | totalSamples)) or
+            (values[1] != TMP007_READY) or
+            (values[2] != TMP007_DEVICE_ID_VALUE))
+    {
+        begin(totalSamples);
+        return false;
+    }
+
+    // Conversions kept running, wait for the next one at most
+    _totalSamples = totalSamples;
+    if (get() == TMP007_STALE)
     {
-        _externalTemperature = (float)(_rawTemperature >> 2) * .03125 + 273.15;
+        _chrono = millis();
+        get(true);
+    }
+    return true;
+}
+
+void Sensor_TMP007::setCalibration(Calibration_Table * table)
+{
+    _calibration = table;
+}
+
+uint8_t Sensor_TMP007::get(bool wait)
+{
+    if (wait)
+    {
+        if (not waitConversion())
+        {
+            return TMP007_STALE;
+        }
     }
     else
     {
-        _externalTemperature = 0.0; // or keep previous reading
+        _raw.status = readRegister16(_address, TMP007_STATUS);
+        if ((_raw.status & TMP007_READY) == 0)
+        {
+            return TMP007_STALE;
+        }
     }
+    _chrono = millis();
+
+    // No register auto-increment: one sweep with repeated starts
+    const uint8_t commands[3] = { TMP007_VOLTAGE, TMP007_INTERNAL_TEMPERATURE, TMP007_EXTERNAL_TEMPERATURE };
+    uint16_t values[3];
+    readRegisters16(_address, commands, values, 3);
+    _raw.voltage = (int16_t)values[0];
+    _raw.internal = (int16_t)values[1];
+    _raw.external = (int16_t)values[2];
+
+    // .03125 = 1 / 32
+    _internalTemperature = (float)(_raw.internal >> 2) * .03125 + 273.15;
+
+    // Check validity in bit 0 and in the status, keep previous reading otherwise
+    if (((_raw.external & 0b1) != 0) or (_raw.status & TMP007_DATA_INVALID))
+    {
+        return TMP007_INVALID;
+    }
+
+    int32_t value = _raw.external >> 2;
+    if (_calibration != NULL)
+    {
+        value = _calibration->apply(value);
+    }
+    _rawExternal = value;
+    _externalTemperature = (float)(value) * .03125 + 273.15;
+    return TMP007_FRESH;
+}
+
+tmp007_raw_s Sensor_TMP007::raw()
+{
+    return _raw;
+}
+
+// Conversion time in ms, per number of samples, then low power modes
+static const uint16_t sampleTime[8] = { 260, 510, 1010, 2010, 4010, 1000, 2000, 4000 };
+
+uint32_t Sensor_TMP007::conversionTime()
+{
+    return sampleTime[_totalSamples >> 9];
+}
+
+bool Sensor_TMP007::waitConversion()
+{
+    uint32_t period = conversionTime();
+
+    // Wait until the conversion is expected
+    uint32_t elapsed = millis() - _chrono;
+    if (elapsed < period)
+    {
+        delay(period - elapsed);
+    }
+
+    // Internal oscillator tolerance, poll up to period / 4 + 32 ms more
+    for (uint8_t retry = 0; retry < 32; retry++)
+    {
+        _raw.status = readRegister16(_address, TMP007_STATUS);
+        if (_raw.status & TMP007_READY)
+        {
+            return true;
+        }
+        delay(1 + period / 128);
+    }
+    return false;
 }
 
+#if (SENSOR_HEAP_FREE == 1)
+const char * Sensor_TMP007::WhoAmI()
+#else
 String Sensor_TMP007::WhoAmI()
+#endif
 {
     return "TMP007 IR temperature";
 }
 
+sensor_device_e Sensor_TMP007::deviceType()
+{
+    return SENSOR_DEVICE_TMP007;
+}
+
 float Sensor_TMP007::internal()
 {
     return _internalTemperature;
@@ -101,6 +220,16 @@ float Sensor_TMP007::external()
     return _externalTemperature;
 }
 
+int32_t Sensor_TMP007::rawInternal()
+{
+    return _raw.internal >> 2;
+}
+
+int32_t Sensor_TMP007::rawExternal()
+{
+    return _rawExternal;
+}
+
 void Sensor_TMP007::setPowerMode(uint8_t mode)
 {
     //    uint16_t statusMaskRegister = readRegister16(_address, TMP007_STATUS_MASK);
@@ -70,9 +70,28 @@
 #define TMP007_ONE_SAMPLE_LOW_POWER     0x0A00
 #define TMP007_TWO_SAMPLES_LOW_POWER    0x0C00
 #define TMP007_FOUR_SAMPLES_LOW_POWER   0x0E00
+
+// get() results
+#define TMP007_FRESH                    0 ///< new measurement
+#define TMP007_STALE                    1 ///< conversion not done, previous values kept
+#define TMP007_INVALID                  2 ///< new internal temperature, invalid external temperature, previous value kept
 /// @}
 
+///
+/// @brief      TMP007 raw registers
+/// @details    Values as read, for off-device object temperature computation
+///
+struct tmp007_raw_s
+{
+    int16_t voltage; ///< sensor voltage, 1 LSB = 156.25 nV
+    int16_t internal; ///< die temperature, bits 15..2, 1 LSB = 1/32 °C after >> 2
+    int16_t external; ///< object temperature, bits 15..2, 1 LSB = 1/32 °C after >> 2, bit 0 = invalid
+    uint16_t status; ///< status register, bit 14 = conversion ready
+};
+
 #include "Wire.h"
+#include "Sensor_Device.h"
+#include "Sensor_Calibration.h"
 
 ///
 /// @brief      Class for sensor TMP007
@@ -94,16 +113,74 @@ class Sensor_TMP007
     ///
     void begin(uint16_t totalSamples = TMP007_FOUR_SAMPLES);
 
+    ///
+    /// @brief	Initialisation, first step: reset
+    /// @param	totalSamples default=4 samples, use pre-defined constants
+    /// @return	period to wait before beginConfigure(), ms
+    /// @note   For parallel initialisation with Sensor_Startup. begin() performs both steps.
+    ///
+    uint32_t beginReset(uint16_t totalSamples = TMP007_FOUR_SAMPLES);
+
+    ///
+    /// @brief	Initialisation, second step: configuration and first conversion
+    /// @return	period to wait before the first get(), ms
+    ///
+    uint32_t beginConfigure();
+
+    ///
+    /// @brief	Initialisation, warm resume
+    /// @param	totalSamples default = 4 samples, use pre-defined constants
+    /// @return	true if resumed without reset, false if begin() was performed
+    /// @note   Configuration, status mask and device identity are read back and compared
+    /// @n      with the requested configuration. The reset is skipped on match.
+    ///
+    bool beginResume(uint16_t totalSamples = TMP007_FOUR_SAMPLES);
+
     ///
     /// @brief	Who Am I?
     /// @return	name of the sensor, string
     ///
+#if (SENSOR_HEAP_FREE == 1)
+    const char * WhoAmI();
+#else
     String WhoAmI();
+#endif
+
+    ///
+    /// @brief	Device type
+    /// @return	device identifier, SENSOR_DEVICE_TMP007
+    ///
+    sensor_device_e deviceType();
 
     ///
     /// @brief	Acquisition
+    /// @param	wait default=false=return TMP007_STALE if the conversion is not done,
+    /// @n      true=wait for the conversion, timed from the number of samples
+    /// @return	TMP007_FRESH, TMP007_STALE or TMP007_INVALID
+    /// @note   The temperatures are only read after the conversion-ready flag is set.
+    /// @n      TMP007_INVALID if bit 0 of the object temperature or the data invalid flag of the status is set.
+    ///
+    uint8_t get(bool wait = false);
+
+    ///
+    /// @brief	Raw registers
+    /// @return	sensor voltage, die temperature and object temperature from the last fresh get(), last status read
+    /// @note   The external value is before software calibration.
+    ///
+    tmp007_raw_s raw();
+
+    ///
+    /// @brief	Conversion time
+    /// @return	duration in ms of one conversion, for the number of samples set by begin()
+    ///
+    uint32_t conversionTime();
+
+    ///
+    /// @brief	Attach a software calibration
+    /// @param	table calibration table, NULL = none
+    /// @note   Integer unit of the table: 1/32 °C, on the external temperature
     ///
-    void get();
+    void setCalibration(Calibration_Table * table);
 
     ///
     /// @brief	Measure
@@ -117,6 +194,18 @@ class Sensor_TMP007
     ///
     float external();
 
+    ///
+    /// @brief	Raw measure
+    /// @return	Internal temperature, 1 LSB = 1/32 °C
+    ///
+    int32_t rawInternal();
+
+    ///
+    /// @brief	Raw measure
+    /// @return	External temperature after software calibration, 1 LSB = 1/32 °C
+    ///
+    int32_t rawExternal();
+
     ///
     /// @brief	Manage power
     /// @param	mode LOW=default=off, HIGH=on
@@ -125,8 +214,15 @@ class Sensor_TMP007
 
 
   private:
+    bool waitConversion();
+
+    Calibration_Table * _calibration;
+    tmp007_raw_s _raw;
+    uint16_t _totalSamples;
+    uint32_t _chrono; ///< ms, last conversion read
     float _internalTemperature;
     float _externalTemperature;
+    int32_t _rawExternal;
     uint8_t _address;
 };
 
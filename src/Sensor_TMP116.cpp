@@ -32,81 +32,377 @@
 #define TMP116_EEPROM4                  0x08
 #define TMP116_DEVICE_ID                0x0f
 
+// Configuration bits          fedcba9876543210
+#define TMP116_MODE_MASK        0b0000110000000000
+#define TMP116_CONVERSION_MASK  0b0000001110000000
+#define TMP116_AVERAGE_MASK     0b0000000001100000
+#define TMP116_ALERT_MASK       0b0000000000011100
+#define TMP116_SAVED_MASK       0b0000111111111100
+
+// EEPROM unlock register
+#define TMP116_EEPROM_UNLOCKED  0x8000
+#define TMP116_EEPROM_LOCKED    0x0000
+
+#define TMP116_ALERT_FLAGS      (TMP116_ALERT_HIGH_LIMIT | TMP116_ALERT_LOW_LIMIT)
+#define TMP116_FLAGS_MASK       (TMP116_ALERT_FLAGS | TMP116_DATA_REDAY)
+
+// Active conversion time per averaging, 15.5 ms rounded up
+static const uint16_t averageTime[4] = { 16, 125, 500, 1000 };
+// Cycle time per conversion setting
+static const uint16_t cycleTime[8] = { 16, 125, 250, 500, 1000, 4000, 8000, 16000 };
+
 // Code
+Sensor_TMP116 * Sensor_TMP116::_interruptInstance = NULL;
+
+void Sensor_TMP116::_interruptISR()
+{
+    if (_interruptInstance != NULL)
+    {
+        _interruptInstance->_pending = true;
+        if (_interruptInstance->_callback != NULL)
+        {
+            _interruptInstance->_callback();
+        }
+    }
+}
+
 Sensor_TMP116::Sensor_TMP116(uint8_t address, uint8_t pinPower)
 {
     _address = address;
     _pinPower = pinPower;
+    _calibration = NULL;
+    _rawTemperature = 0;
+    _configuration = TMP116_CONVERSION_1_SECOND + TMP116_EIGHT_SAMPLES;
+    _mode = TMP116_MODE_CONTINUOUS;
+    _pending = false;
+    _callback = NULL;
+    _interruptPin = 0;
+    _flags = 0;
+}
+
+void Sensor_TMP116::begin(uint16_t totalSamples, uint16_t conversion, uint16_t mode)
+{
+    delay(beginReset(totalSamples, conversion, mode));
+    uint32_t period = beginConfigure();
+
+    if (_mode == TMP116_MODE_ONCE)
+    {
+        get();
+    }
+    else if (waitDataReady(period))
+    {
+        readTemperature();
+    }
+}
+
+uint32_t Sensor_TMP116::beginReset(uint16_t totalSamples, uint16_t conversion, uint16_t mode)
+{
+    _configuration = (conversion & TMP116_CONVERSION_MASK) | (totalSamples & TMP116_AVERAGE_MASK);
+    _mode = ((mode & TMP116_MODE_MASK) == TMP116_MODE_ONCE) ? TMP116_MODE_ONCE : TMP116_MODE_CONTINUOUS;
+
+    if (_pinPower > 0)
+    {
+        pinMode(_pinPower, OUTPUT);
+        digitalWrite(_pinPower, HIGH);
+    }
+
+    // Power-up time, 1.5 ms
+    return 2;
+}
+
+uint32_t Sensor_TMP116::beginConfigure()
+{
+    // Keep the alert configuration, possibly loaded from EEPROM
+    _configuration |= readConfiguration() & TMP116_ALERT_MASK;
+    // Any latched result predates the new configuration
+    _flags &= ~TMP116_DATA_REDAY;
+
+    if (_mode == TMP116_MODE_ONCE)
+    {
+        writeConfiguration(TMP116_MODE_SHUTDOWN);
+        return 0;
+    }
+
+    // Writing the configuration restarts the conversion,
+    // the first result is ready after the averaging, before the end of the cycle
+    writeConfiguration(TMP116_MODE_CONTINUOUS);
+    return averageTime[(_configuration & TMP116_AVERAGE_MASK) >> 5];
 }
 
-void Sensor_TMP116::begin(uint16_t totalSamples)
+bool Sensor_TMP116::beginSaved(uint16_t totalSamples, uint16_t conversion, uint16_t mode)
 {
-//    writeRegister16(_address, TMP116_CONFIGURATION, TMP116_CONVERSION_1_SECOND + TMP116_EIGHT_SAMPLES + TMP116_MODE_CONTINUOUS);
     if (_pinPower > 0)
     {
         pinMode(_pinPower, OUTPUT);
         digitalWrite(_pinPower, HIGH);
     }
 
-    delay(100);
-    get();
-    delay(100);
+    // EEPROM is loaded 1.5 ms after power-up
+    delay(2);
+
+    uint16_t configuration = readConfiguration();
+    _configuration = configuration & TMP116_ALERT_MASK;
+    _configuration |= (conversion & TMP116_CONVERSION_MASK) | (totalSamples & TMP116_AVERAGE_MASK);
+    _mode = ((mode & TMP116_MODE_MASK) == TMP116_MODE_ONCE) ? TMP116_MODE_ONCE : TMP116_MODE_CONTINUOUS;
+
+    uint16_t expected = _configuration | ((_mode == TMP116_MODE_ONCE) ? TMP116_MODE_SHUTDOWN : TMP116_MODE_CONTINUOUS);
+    if ((configuration & TMP116_SAVED_MASK) == expected)
+    {
+        return true;
+    }
+
+    writeConfiguration(expected & TMP116_MODE_MASK);
+    return false;
+}
+
+bool Sensor_TMP116::saveConfiguration()
+{
+    uint16_t configuration = _configuration | ((_mode == TMP116_MODE_ONCE) ? TMP116_MODE_SHUTDOWN : TMP116_MODE_CONTINUOUS);
+    uint16_t highLimit = readRegister16(_address, TMP116_HIGH_LIMIT);
+    uint16_t lowLimit = readRegister16(_address, TMP116_LOW_LIMIT);
+
+    writeRegister16(_address, TMP116_EEPROM_UNLOCK, TMP116_EEPROM_UNLOCKED);
+    bool result = writeEeprom(TMP116_CONFIGURATION, configuration);
+    result = result and writeEeprom(TMP116_HIGH_LIMIT, highLimit);
+    result = result and writeEeprom(TMP116_LOW_LIMIT, lowLimit);
+    writeRegister16(_address, TMP116_EEPROM_UNLOCK, TMP116_EEPROM_LOCKED);
+
+    // Verify
+    result = result and ((readConfiguration() & TMP116_SAVED_MASK) == configuration);
+    result = result and (readRegister16(_address, TMP116_HIGH_LIMIT) == highLimit);
+    result = result and (readRegister16(_address, TMP116_LOW_LIMIT) == lowLimit);
+    return result;
+}
+
+bool Sensor_TMP116::writeEeprom(uint8_t command, uint16_t data16)
+{
+    writeRegister16(_address, command, data16);
+
+    // Programming takes 7 ms, poll up to 16 ms more
+    delay(7);
+    for (uint8_t retry = 0; retry < 16; retry++)
+    {
+        if ((readConfiguration() & TMP116_EEPROM_BUSY) == 0)
+        {
+            return true;
+        }
+        delay(1);
+    }
+    return false;
+}
+
+void Sensor_TMP116::setCalibration(Calibration_Table * table)
+{
+    _calibration = table;
+}
+
+uint8_t Sensor_TMP116::get()
+{
+    if (_mode == TMP116_MODE_ONCE)
+    {
+        triggerMeasurement();
+        if (not waitDataReady(conversionTime()))
+        {
+            return TMP116_STALE;
+        }
+        readTemperature();
+        return TMP116_FRESH;
+    }
+
+    return readMeasurement();
+}
+
+void Sensor_TMP116::triggerMeasurement()
+{
+    // Continuous mode converts on its own
+    if (_mode == TMP116_MODE_ONCE)
+    {
+        _flags &= ~TMP116_DATA_REDAY;
+        writeConfiguration(TMP116_MODE_ONCE);
+    }
+}
+
+uint8_t Sensor_TMP116::readMeasurement()
+{
+    // Data ready may have been latched by alert() or another read of the configuration
+    if ((_flags & TMP116_DATA_REDAY) == 0)
+    {
+        readConfiguration();
+    }
+    if ((_flags & TMP116_DATA_REDAY) == 0)
+    {
+        return TMP116_STALE;
+    }
+
+    readTemperature();
+    return TMP116_FRESH;
 }
 
-void Sensor_TMP116::get()
+uint32_t Sensor_TMP116::conversionTime()
 {
-//    uint16_t _register = readRegister16(_address, TMP116_CONFIGURATION);
-//    _register &= ~0b0000110000000000;
-//    _register |= TMP116_MODE_ONCE;
-//    writeRegister16(_address, TMP116_CONFIGURATION, _register);
+    uint32_t result = averageTime[(_configuration & TMP116_AVERAGE_MASK) >> 5];
+    if (_mode == TMP116_MODE_CONTINUOUS)
+    {
+        uint32_t cycle = cycleTime[(_configuration & TMP116_CONVERSION_MASK) >> 7];
+        if (cycle > result)
+        {
+            result = cycle;
+        }
+    }
+    return result;
+}
 
-    _rawTemperature = readRegister16(_address, TMP116_TEMPERATURE);
+void Sensor_TMP116::readTemperature()
+{
+    _flags &= ~TMP116_DATA_REDAY;
+    _rawTemperature = (int16_t)readRegister16(_address, TMP116_TEMPERATURE);
+    if (_calibration != NULL)
+    {
+        _rawTemperature = _calibration->apply(_rawTemperature);
+    }
+}
+
+bool Sensor_TMP116::waitDataReady(uint32_t period)
+{
+    // Internal oscillator tolerance, poll up to period / 4 + 32 ms more
+    delay(period);
+    for (uint8_t retry = 0; retry < 32; retry++)
+    {
+        readConfiguration();
+        if (_flags & TMP116_DATA_REDAY)
+        {
+            return true;
+        }
+        delay(1 + period / 128);
+    }
+    return false;
+}
 
-//    _register &= ~0b0000110000000000;
-//    _register |= TMP116_MODE_SHUTDOWN;
-//    writeRegister16(_address, TMP116_CONFIGURATION, _register);
+uint16_t Sensor_TMP116::readConfiguration()
+{
+    // Reading clears the data-ready flag, and the alert flags in alert mode,
+    // so they are latched until consumed by get() and alert()
+    uint16_t result = readRegister16(_address, TMP116_CONFIGURATION);
+    _flags |= result & TMP116_FLAGS_MASK;
+    return result;
 }
 
+void Sensor_TMP116::writeConfiguration(uint16_t mode)
+{
+    writeRegister16(_address, TMP116_CONFIGURATION, _configuration | mode);
+}
+
+#if (SENSOR_HEAP_FREE == 1)
+const char * Sensor_TMP116::WhoAmI()
+#else
 String Sensor_TMP116::WhoAmI()
+#endif
 {
     return "TMP116 temperature";
 }
 
+sensor_device_e Sensor_TMP116::deviceType()
+{
+    return SENSOR_DEVICE_TMP116;
+}
+
 float Sensor_TMP116::temperature()
 {
     return (float)(_rawTemperature) * 0.0078125 + 273.15;
     ;
 }
 
-void Sensor_TMP116::setPowerMode(uint8_t mode)
+int32_t Sensor_TMP116::rawTemperature()
 {
-    // Problem:
-    // Current configuration should be saved for later re-use
-//    if (_pinPower > 0) {
-//        digitalWrite(_pinPower, mode);
-//    }
+    return _rawTemperature;
+}
+
+static uint16_t limitRegister(float temperature)
+{
+    // 1 LSB = 1/128 °C, saturated
+    float value = temperature * 128.0;
+    if (value >= 32767.0)
+    {
+        return 0x7fff;
+    }
+    if (value <= -32768.0)
+    {
+        return 0x8000;
+    }
+    return (uint16_t)(int16_t)((value < 0) ? value - 0.5 : value + 0.5);
+}
 
-    //    uint16_t statusMaskRegister = readRegister16(_address, TMP116_STATUS_MASK);
-    //    Serial.print("sm=\t");
-    //    Serial.print(statusMaskRegister, BIN);
+void Sensor_TMP116::setLimits(float lowTemperature, float highTemperature)
+{
+    writeRegister16(_address, TMP116_HIGH_LIMIT, limitRegister(highTemperature));
+    writeRegister16(_address, TMP116_LOW_LIMIT, limitRegister(lowTemperature));
+}
 
-//    uint16_t _register = readRegister16(_address, TMP116_CONFIGURATION);
+void Sensor_TMP116::beginAlert(uint8_t interruptPin, uint16_t alertMode, void (*callback)(void))
+{
+    _configuration &= ~TMP116_ALERT_MASK;
+    _configuration |= (alertMode & TMP116_MODE_TEMPERATURE) | TMP116_ALERT_PIN_LOW | TMP116_IRQ_ALERT;
+    writeConfiguration((_mode == TMP116_MODE_ONCE) ? TMP116_MODE_SHUTDOWN : TMP116_MODE_CONTINUOUS);
 
-    //    Serial.print(configurationRegister, BIN);
+    // Clear any previous flag, so the next alert drives the output
+    readConfiguration();
+    _flags &= ~TMP116_ALERT_FLAGS;
+    _pending = false;
 
-//    if (mode == HIGH)
-//    {
-//        _register |= TMP116_POWER_UP;
-//    }
-//    else
-//    {
-//        _register &= ~TMP116_POWER_UP;
-//    }
+    if (interruptPin > 0)
+    {
+        _interruptPin = interruptPin;
+        _callback = callback;
+        _interruptInstance = this;
 
-    //    Serial.print("\tc=\t");
-    //    Serial.print(configurationRegister, BIN);
-    //    Serial.println();
-    //
-//    writeRegister16(_address, TMP116_CONFIGURATION, _register);
+        // ALERT is open-drain, active low
+        pinMode(_interruptPin, INPUT_PULLUP);
+        attachInterrupt(_interruptPin, _interruptISR, FALLING);
+        // Output already low means the falling edge was missed
+        if (digitalRead(_interruptPin) == LOW)
+        {
+            _pending = true;
+        }
+    }
 }
 
+void Sensor_TMP116::endAlert()
+{
+    if (_interruptPin > 0)
+    {
+        detachInterrupt(_interruptPin);
+    }
+    _interruptPin = 0;
+    _callback = NULL;
+    _pending = false;
+    _interruptInstance = NULL;
+}
+
+uint16_t Sensor_TMP116::alert()
+{
+    if ((_interruptPin > 0) and not _pending and ((_flags & TMP116_ALERT_FLAGS) == 0))
+    {
+        return 0;
+    }
+    _pending = false;
+
+    readConfiguration();
+    uint16_t result = _flags & TMP116_ALERT_FLAGS;
+    _flags &= ~TMP116_ALERT_FLAGS;
+    return result;
+}
+
+void Sensor_TMP116::setPowerMode(uint8_t mode)
+{
+    if (mode == HIGH)
+    {
+        if (_mode == TMP116_MODE_CONTINUOUS)
+        {
+            writeConfiguration(TMP116_MODE_CONTINUOUS);
+        }
+    }
+    else
+    {
+        writeConfiguration(TMP116_MODE_SHUTDOWN);
+    }
+}
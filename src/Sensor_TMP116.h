@@ -87,6 +87,7 @@
 #define TMP116_CONVERSION_1_SECOND      0b0000001000000000
 #define TMP116_CONVERSION_4_SECONDS     0b0000001010000000
 #define TMP116_CONVERSION_8_SECONDS     0b0000001100000000
+#define TMP116_CONVERSION_16_SECONDS    0b0000001110000000
 
 // bits 65                                fedcba9876543210
 #define TMP116_NO_AVERAGE               0b0000000000000000
@@ -105,9 +106,15 @@
 // bit  2                                 fedcba9876543210
 #define TMP116_IRQ_DATA_READY           0b0000000000000100
 #define TMP116_IRQ_ALERT                0b0000000000000000
+
+// get() results
+#define TMP116_FRESH                    0 ///< new measurement
+#define TMP116_STALE                    1 ///< no new measurement, previous value kept
 /// @}
 
 #include "Wire.h"
+#include "Sensor_Device.h"
+#include "Sensor_Calibration.h"
 
 ///
 /// @brief      Class for sensor TMP116
@@ -127,19 +134,101 @@ class Sensor_TMP116
     ///
     /// @brief	Initialisation
     /// @param	totalSamples default=8 samples, use pre-defined constants
+    /// @param	conversion conversion cycle in continuous mode, default=1 second, use pre-defined constants
+    /// @param	mode default=TMP116_MODE_CONTINUOUS, or TMP116_MODE_ONCE
+    /// @note   Alert configuration bits are kept.
+    ///
+    void begin(uint16_t totalSamples = TMP116_EIGHT_SAMPLES, uint16_t conversion = TMP116_CONVERSION_1_SECOND, uint16_t mode = TMP116_MODE_CONTINUOUS);
+
+    ///
+    /// @brief	Initialisation, first step: power-up
+    /// @param	totalSamples default=8 samples, use pre-defined constants
+    /// @param	conversion conversion cycle in continuous mode, default=1 second, use pre-defined constants
+    /// @param	mode default=TMP116_MODE_CONTINUOUS, or TMP116_MODE_ONCE
+    /// @return	period to wait before beginConfigure(), ms
+    /// @note   For parallel initialisation with Sensor_Startup. begin() performs both steps.
+    ///
+    uint32_t beginReset(uint16_t totalSamples = TMP116_EIGHT_SAMPLES, uint16_t conversion = TMP116_CONVERSION_1_SECOND, uint16_t mode = TMP116_MODE_CONTINUOUS);
+
+    ///
+    /// @brief	Initialisation, second step: configuration and first conversion
+    /// @return	period to wait before the first get(), ms, 0 in one-shot mode
+    /// @note   In continuous mode, the first result is ready after the averaging time,
+    ///         125 ms with 8 samples, then every conversionTime().
+    ///
+    uint32_t beginConfigure();
+
+    ///
+    /// @brief	Initialisation from the configuration saved in EEPROM
+    /// @param	totalSamples default=8 samples, use pre-defined constants
+    /// @param	conversion conversion cycle in continuous mode, default=1 second, use pre-defined constants
+    /// @param	mode default=TMP116_MODE_CONTINUOUS, or TMP116_MODE_ONCE
+    /// @return	true if the TMP116 has powered up with this configuration, no write;
+    /// @n      false otherwise, the configuration is then written, call saveConfiguration() to keep it
+    /// @note   Only reads the configuration register: no reset, no write, no measurement.
+    /// @n      With pinPower, this allows to power-cycle the TMP116 between measurements.
     ///
-    void begin(uint16_t totalSamples = TMP116_EIGHT_SAMPLES);
+    bool beginSaved(uint16_t totalSamples = TMP116_EIGHT_SAMPLES, uint16_t conversion = TMP116_CONVERSION_1_SECOND, uint16_t mode = TMP116_MODE_CONTINUOUS);
+
+    ///
+    /// @brief	Save the configuration and the alert limits to EEPROM
+    /// @return	true if saved and verified, false otherwise
+    /// @note   The TMP116 then powers up with this configuration.
+    /// @n      One-shot mode is saved as shutdown mode.
+    /// @n      Each EEPROM word takes about 7 ms to program, and the EEPROM has a limited number of cycles.
+    ///
+    bool saveConfiguration();
 
     ///
     /// @brief	Who Am I?
     /// @return	name of the sensor, string
     ///
+#if (SENSOR_HEAP_FREE == 1)
+    const char * WhoAmI();
+#else
     String WhoAmI();
+#endif
+
+    ///
+    /// @brief	Device type
+    /// @return	device identifier, SENSOR_DEVICE_TMP116
+    ///
+    sensor_device_e deviceType();
 
     ///
     /// @brief	Acquisition
+    /// @return	TMP116_FRESH or TMP116_STALE
+    /// @note   In continuous mode, only reads the temperature if a new conversion is ready.
+    /// @n      The data-ready flag is latched, so alert() or saveConfiguration() do not hide a new conversion.
+    /// @n      In one-shot mode, triggers a conversion and waits for it, see conversionTime().
+    ///
+    uint8_t get();
+
+    ///
+    /// @brief	Start a conversion, without waiting
+    /// @note   In one-shot mode, writes the one-shot mode to the configuration register.
+    /// @n      In continuous mode, does nothing as the TMP116 converts on its own.
+    ///
+    void triggerMeasurement();
+
     ///
-    void get();
+    /// @brief	Read the last conversion, without waiting
+    /// @return	TMP116_FRESH, or TMP116_STALE if no new conversion is ready
+    ///
+    uint8_t readMeasurement();
+
+    ///
+    /// @brief	Conversion time
+    /// @return	duration in ms of one conversion in one-shot mode, or of the cycle in continuous mode
+    ///
+    uint32_t conversionTime();
+
+    ///
+    /// @brief	Attach a software calibration
+    /// @param	table calibration table, NULL = none
+    /// @note   Integer unit of the table: 1/128 °C
+    ///
+    void setCalibration(Calibration_Table * table);
 
     ///
     /// @brief	Measure
@@ -147,15 +236,72 @@ class Sensor_TMP116
     ///
     float temperature();
 
+    ///
+    /// @brief	Raw measure
+    /// @return	Temperature after software calibration, 1 LSB = 1/128 °C
+    ///
+    int32_t rawTemperature();
+
+    ///
+    /// @brief	Set the alert limits
+    /// @param	lowTemperature low limit, in °C
+    /// @param	highTemperature high limit, in °C
+    /// @note   For kelvin, subtract 273.15. Resolution is 1/128 °C.
+    /// @n      Limits apply to the temperature before software calibration.
+    ///
+    void setLimits(float lowTemperature, float highTemperature);
+
+    ///
+    /// @brief	Initialisation of the alert events
+    /// @param	interruptPin pin connected to the ALERT output, 0=none and alert() polls the sensor
+    /// @param	alertMode default=TMP116_MODE_ALERT, or TMP116_MODE_TEMPERATURE for therm mode
+    /// @param	callback function called by the interrupt, default=NULL=none
+    /// @note   Call after begin() and setLimits(). ALERT is set to active low, on alert flags.
+    /// @n      Alert mode: a flag is set when the temperature crosses a limit, and cleared by alert().
+    /// @n      Therm mode: the high flag is set above the high limit, and cleared below the low limit.
+    /// @note   Only one TMP116 can use the ALERT interrupt. The callback runs in interrupt context.
+    ///
+    void beginAlert(uint8_t interruptPin, uint16_t alertMode = TMP116_MODE_ALERT, void (*callback)(void) = NULL);
+
+    ///
+    /// @brief	Stop the alert events
+    ///
+    void endAlert();
+
+    ///
+    /// @brief	Service alert events
+    /// @return	0 if no alert, otherwise TMP116_ALERT_HIGH_LIMIT and TMP116_ALERT_LOW_LIMIT flags
+    /// @note   Flags read by get() meanwhile are kept for alert().
+    /// @n      With an interrupt pin, returns 0 without bus traffic if there is no alert.
+    ///
+    uint16_t alert();
+
     ///
     /// @brief	Manage power
-    /// @param	mode LOW=default=off, HIGH=on
-    /// @note   Not implemented, for compatibility only
+    /// @param	mode LOW=default=shutdown, HIGH=mode set by begin()
+    /// @note   In one-shot mode, the TMP116 shuts down after each conversion, so HIGH has no effect.
+    /// @n      The rest of the configuration is kept.
     ///
     void setPowerMode(uint8_t mode = LOW);
 
   private:
-    int16_t _rawTemperature;
+    static Sensor_TMP116 * _interruptInstance;
+    static void _interruptISR();
+    volatile bool _pending;
+    void (*_callback)(void);
+    uint8_t _interruptPin;
+    uint16_t _flags; ///< alert and data-ready flags read but not yet consumed by alert() and get()
+
+    void readTemperature();
+    bool waitDataReady(uint32_t period);
+    uint16_t readConfiguration();
+    void writeConfiguration(uint16_t mode);
+    bool writeEeprom(uint8_t command, uint16_t data16);
+
+    uint16_t _configuration; ///< conversion, averaging and alert bits, without mode
+    uint16_t _mode; ///< TMP116_MODE_CONTINUOUS or TMP116_MODE_ONCE
+    Calibration_Table * _calibration;
+    int32_t _rawTemperature;
     uint8_t _address;
     uint8_t _pinPower;
 };
@@ -20,5 +20,319 @@
 // Include library header
 #include "Sensor_Units.h"
 
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
 // Library code
-// Empty, because template <typename ...> shall be in the same file.
+// Template functions are in the header, because template <typename ...> shall be in the same file.
+
+void conversion(const float * input, float * output, size_t count, unit_transform_s transform)
+{
+    size_t index = 0;
+
+#if defined(__SSE__)
+    // Host only, 4 values per iteration
+    const __m128 gain = _mm_set1_ps(transform.gain);
+    const __m128 base = _mm_set1_ps(transform.base);
+
+    for (; index + 4 <= count; index += 4)
+    {
+        __m128 value = _mm_loadu_ps(input + index);
+        value = _mm_add_ps(_mm_mul_ps(value, gain), base);
+        _mm_storeu_ps(output + index, value);
+    }
+#endif
+
+    // MCU, or remaining values on host
+    for (; index < count; index++)
+    {
+        output[index] = input[index] * transform.gain + transform.base;
+    }
+}
+
+void conversion(const int32_t * input, int32_t * output, size_t count, unit_transform_s transform, uint8_t fractionBits)
+{
+    if (fractionBits > 16)
+    {
+        fractionBits = 16;
+    }
+
+    // Gain normalised to [2^29, 2^30), so input * gain fits on 62 bits
+    // The gain comes from a float, so only its 24 most significant bits are exact
+    float scaledGain = (transform.gain < 0) ? -transform.gain : transform.gain;
+    uint8_t shift = 0;
+    if (scaledGain > 0)
+    {
+        while ((scaledGain < 536870912.0f) and (shift < 60))
+        {
+            scaledGain *= 2.0f;
+            shift++;
+        }
+    }
+
+    // |gain| >= 2^29 leaves no shift for the rounding, use double instead
+    if ((shift == 0) and (scaledGain > 0))
+    {
+        const double base = (double)transform.base * (double)((uint32_t)1 << fractionBits);
+        for (size_t index = 0; index < count; index++)
+        {
+            double value = (double)input[index] * transform.gain + base;
+            value = (value < -2147483648.0) ? -2147483648.0 : ((value > 2147483647.0) ? 2147483647.0 : value);
+            output[index] = (int32_t)((value < 0) ? value - 0.5 : value + 0.5);
+        }
+        return;
+    }
+    if (shift == 0)
+    {
+        shift = 1; // gain = 0
+    }
+
+    const int64_t gain = (int64_t)((transform.gain < 0) ? -scaledGain : scaledGain);
+    const int64_t base = (int64_t)(transform.base * (float)((uint32_t)1 << fractionBits) + (transform.base < 0 ? -0.5f : 0.5f));
+    const int64_t rounding = (int64_t)1 << (shift - 1);
+
+    for (size_t index = 0; index < count; index++)
+    {
+        int64_t value = (((int64_t)input[index] * gain + rounding) >> shift) + base;
+        value = (value < INT32_MIN) ? INT32_MIN : ((value > INT32_MAX) ? INT32_MAX : value);
+        output[index] = (int32_t)value;
+    }
+}
+
+// Formatting
+// Append one character, keeping room for the final \0
+static bool appendChar(char * buffer, size_t size, size_t & length, char character)
+{
+    if (length + 1 >= size)
+    {
+        return false;
+    }
+    buffer[length++] = character;
+    return true;
+}
+
+static bool appendText(char * buffer, size_t size, size_t & length, const char * text)
+{
+    while (*text != '\0')
+    {
+        if (not appendChar(buffer, size, length, *text++))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Symbol, with UTF-8 ° = 0xc2 0xb0 adapted to options
+static bool appendSymbol(char * buffer, size_t size, size_t & length, const char * symbol, uint8_t options)
+{
+    while (*symbol != '\0')
+    {
+        if (((uint8_t)symbol[0] == 0xc2) and ((uint8_t)symbol[1] == 0xb0))
+        {
+            symbol += 2;
+            if (options == UNITS_DEGREE_UTF8)
+            {
+                if (not appendText(buffer, size, length, "\xc2\xb0"))
+                {
+                    return false;
+                }
+            }
+            else if (options == UNITS_DEGREE_LATIN1)
+            {
+                if (not appendChar(buffer, size, length, (char)0xb0))
+                {
+                    return false;
+                }
+            }
+        }
+        else if (not appendChar(buffer, size, length, *symbol++))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Fixed-point decimal, without printf
+static bool appendValue(char * buffer, size_t size, size_t & length, float value, uint8_t decimals)
+{
+    static const uint32_t powers[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+    if (decimals > 6)
+    {
+        decimals = 6;
+    }
+
+    if (value != value) // NaN
+    {
+        return appendText(buffer, size, length, "nan");
+    }
+
+    bool negative = (value < 0);
+    if (negative)
+    {
+        value = -value;
+    }
+
+    // Integer and fractional parts apart, so the scale by 10^decimals never overflows
+    // Beyond 2^64, nothing meaningful is left for a sensor
+    if (value >= 18446742974197923840.0f)
+    {
+        return appendText(buffer, size, length, negative ? "-inf" : "inf");
+    }
+    uint64_t integer = (uint64_t)value;
+    uint32_t fraction = (uint32_t)((value - (float)integer) * (float)powers[decimals] + 0.5f);
+    if (fraction >= powers[decimals])
+    {
+        fraction -= powers[decimals];
+        integer++;
+    }
+
+    // Digits in reverse order, fraction first
+    char digits[28];
+    uint8_t count = 0;
+    for (uint8_t index = 0; index < decimals; index++)
+    {
+        digits[count++] = '0' + (fraction % 10);
+        fraction /= 10;
+    }
+    bool zero = (integer == 0);
+    for (uint8_t index = 0; (index < decimals) and zero; index++)
+    {
+        zero = (digits[index] == '0');
+    }
+    do
+    {
+        digits[count++] = '0' + (integer % 10);
+        integer /= 10;
+    }
+    while (integer > 0);
+
+    if (negative and not zero and not appendChar(buffer, size, length, '-'))
+    {
+        return false;
+    }
+    while (count > 0)
+    {
+        if ((count == decimals) and not appendChar(buffer, size, length, '.'))
+        {
+            return false;
+        }
+        if (not appendChar(buffer, size, length, digits[--count]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t formatUnit(char * buffer, size_t size, float value, const unit_conversion_s & unit, uint8_t decimals, uint8_t options)
+{
+    size_t length = 0;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    if (appendValue(buffer, size, length, value, decimals) and appendSymbol(buffer, size, length, unit.symbol, options))
+    {
+        buffer[length] = '\0';
+        return length;
+    }
+
+    buffer[0] = '\0';
+    return 0;
+}
+
+// Line builder
+Units_Line::Units_Line(char * buffer, size_t size, char separator, uint8_t options)
+{
+    _buffer = buffer;
+    _size = size;
+    _separator = separator;
+    _options = options;
+    clear();
+}
+
+void Units_Line::clear()
+{
+    _length = 0;
+    _overflow = false;
+    if (_size > 0)
+    {
+        _buffer[0] = '\0';
+    }
+}
+
+bool Units_Line::add(const char * label, float value, const unit_conversion_s & unit, uint8_t decimals)
+{
+    size_t length = _length;
+    bool result = true;
+
+    if (length > 0)
+    {
+        result = appendChar(_buffer, _size, length, _separator);
+    }
+    if (result and (label != NULL))
+    {
+        result = appendText(_buffer, _size, length, label) and appendChar(_buffer, _size, length, '=');
+    }
+    result = result and appendValue(_buffer, _size, length, value, decimals) and appendSymbol(_buffer, _size, length, unit.symbol, _options);
+
+    if (result)
+    {
+        _length = length;
+    }
+    else
+    {
+        _overflow = true;
+    }
+    if (_size > 0)
+    {
+        _buffer[_length] = '\0';
+    }
+    return result;
+}
+
+bool Units_Line::add(const char * text)
+{
+    size_t length = _length;
+    bool result = appendText(_buffer, _size, length, text);
+
+    if (result)
+    {
+        _length = length;
+    }
+    else
+    {
+        _overflow = true;
+    }
+    if (_size > 0)
+    {
+        _buffer[_length] = '\0';
+    }
+    return result;
+}
+
+bool Units_Line::end()
+{
+    return add("\r\n");
+}
+
+const char * Units_Line::c_str()
+{
+    return _buffer;
+}
+
+size_t Units_Line::length()
+{
+    return _length;
+}
+
+bool Units_Line::overflow()
+{
+    return _overflow;
+}
@@ -22,7 +22,7 @@
 ///
 /// @brief	Release
 ///
-#define Sensor_Units_RELEASE 102
+#define Sensor_Units_RELEASE 103
 
 
 // Include core library - IDE-based
@@ -57,6 +57,8 @@
 #   error Platform not defined
 #endif // end IDE
 
+#include "Sensor_Device.h"
+
 
 // Library header
 ///
@@ -114,6 +116,23 @@ typedef unit_conversion_s light_unit_t;
 const light_unit_t LUX         = { 1, 0, "lx"};           ///< lx lux
 /// @}
 
+///
+/// @brief	    Humidity units
+/// @details    SI reference = % relative humidity
+/// @{
+typedef unit_conversion_s humidity_unit_t;
+const humidity_unit_t PERCENT  = { 1, 0, "%"};            ///< % relative humidity
+/// @}
+
+///
+/// @brief	    Degree sign options for formatting
+/// @details    The symbols are stored as UTF-8, ° = 0xc2 0xb0
+/// @{
+#define UNITS_DEGREE_UTF8   0 ///< ° as UTF-8, 2 bytes, default
+#define UNITS_DEGREE_LATIN1 1 ///< ° as ISO 8859-1, 1 byte 0xb0
+#define UNITS_DEGREE_NONE   2 ///< ° removed, ASCII only
+/// @}
+
 ///
 /// @brief	    Conversion utility
 /// @param	    value input value to be converted, float
@@ -127,26 +146,179 @@ float conversion(float value, myType unitFrom, myType unitTo)
     return (value - unitFrom.base) / unitFrom.gain * unitTo.gain + unitTo.base;
 }
 
+///
+/// @brief      Pre-computed transformation between two units
+/// @details    output = input * gain + base, without division
+/// @note       Use transformation() to build it from two unit constants
+///
+struct unit_transform_s
+{
+    float gain; ///< gain
+    float base; ///< base
+};
+
+///
+/// @brief	    Transformation utility
+/// @param	    unitFrom unit of the input values to be converted
+/// @param	    unitTo unit for the output converted values
+/// @return	    transformation to be used for batch conversion
+/// @note       The division is performed once here, not per value
+///
+template <typename myType>
+unit_transform_s transformation(myType unitFrom, myType unitTo)
+{
+    unit_transform_s result;
+    result.gain = unitTo.gain / unitFrom.gain;
+    result.base = unitTo.base - unitFrom.base * result.gain;
+    return result;
+}
+
+///
+/// @brief	    Batch conversion utility, float
+/// @param	    input array of values to be converted
+/// @param	    output array for the converted values, may be the same as input
+/// @param	    count number of values
+/// @param	    transform transformation from transformation()
+/// @note       On hosts with SSE, 4 values are converted per instruction.
+/// @n          On MCUs, the loop is scalar.
+/// @code
+///    unit_transform_s k2c = transformation(KELVIN, CELSIUS);
+///    conversion(samples, samples, count, k2c);
+/// @endcode
+///
+void conversion(const float * input, float * output, size_t count, unit_transform_s transform);
+
+///
+/// @brief	    Batch conversion utility, fixed-point
+/// @param	    input array of values to be converted, scaled by 2^fractionBits
+/// @param	    output array for the converted values, scaled by 2^fractionBits, may be the same as input
+/// @param	    count number of values
+/// @param	    transform transformation from transformation()
+/// @param	    fractionBits number of fractional bits of input and output, 0..16
+/// @note       The gain is a float, exact to 24 significant bits, applied with 64-bit integer arithmetic.
+/// @n          The error is 0.5 LSB plus 2^-24 of the value. |gain| >= 2^29 falls back to double arithmetic.
+/// @n          Results beyond the int32_t range saturate to INT32_MIN or INT32_MAX, on both paths.
+///
+void conversion(const int32_t * input, int32_t * output, size_t count, unit_transform_s transform, uint8_t fractionBits = 0);
+
+#if (SENSOR_HEAP_FREE == 0)
 ///
 /// @brief	    Unit symbol as String
 /// @param	    unit unit constant
 /// @return	    symbol as String
+/// @warning    String allocates on the heap, prefer symbolChar() or formatUnit()
 ///
 template <typename myType>
-String symbolString(myType unit)
+String symbolString(const myType & unit)
 {
     return String(unit.symbol);
 }
+#endif // SENSOR_HEAP_FREE
 
 ///
 /// @brief	    Unit symbol as char*
 /// @param	    unit unit constant
-/// @return	    symbol as char*
+/// @return	    symbol as char*, pointing to the unit constant
 ///
 template <typename myType>
-char * symbolChar(myType unit)
+const char * symbolChar(const myType & unit)
 {
     return unit.symbol;
 }
 
+///
+/// @brief	    Format value and unit symbol, without allocation
+/// @param	    buffer caller buffer
+/// @param	    size size of the buffer, including the final \0
+/// @param	    value value to be formatted, already in unit
+/// @param	    unit unit constant for the symbol
+/// @param	    decimals number of decimals, 0..6, default=2
+/// @param	    options degree sign option, default=UNITS_DEGREE_UTF8
+/// @return	    number of characters written, excluding the final \0; 0 if the buffer is too small
+/// @code
+///    char text[16];
+///    formatUnit(text, sizeof(text), conversion(value, KELVIN, CELSIUS), CELSIUS, 1);
+/// @endcode
+///
+size_t formatUnit(char * buffer, size_t size, float value, const unit_conversion_s & unit, uint8_t decimals = 2, uint8_t options = UNITS_DEGREE_UTF8);
+
+///
+/// @brief      Line builder for a multi-sensor record
+/// @details    Assembles label=value+symbol fields in a caller buffer, for a single Serial.write()
+/// @code
+///    char text[128];
+///    Units_Line line(text, sizeof(text));
+///    line.add("temperature", 22.5, CELSIUS);
+///    line.add("light", 120.0, LUX, 0);
+///    line.end();
+///    Serial.write((const uint8_t *)line.c_str(), line.length());
+/// @endcode
+///
+class Units_Line
+{
+  public:
+    ///
+    /// @brief	Constructor
+    /// @param	buffer caller buffer
+    /// @param	size size of the buffer, including the final \0
+    /// @param	separator between fields, default=','
+    /// @param	options degree sign option, default=UNITS_DEGREE_UTF8
+    ///
+    Units_Line(char * buffer, size_t size, char separator = ',', uint8_t options = UNITS_DEGREE_UTF8);
+
+    ///
+    /// @brief	Empty the line
+    ///
+    void clear();
+
+    ///
+    /// @brief	Add a field
+    /// @param	label label of the field, may be NULL
+    /// @param	value value, already in unit
+    /// @param	unit unit constant for the symbol
+    /// @param	decimals number of decimals, 0..6, default=2
+    /// @return	true if the field fits, false otherwise and the line is unchanged
+    ///
+    bool add(const char * label, float value, const unit_conversion_s & unit, uint8_t decimals = 2);
+
+    ///
+    /// @brief	Add text, without separator
+    /// @param	text text
+    /// @return	true if the text fits, false otherwise and the line is unchanged
+    ///
+    bool add(const char * text);
+
+    ///
+    /// @brief	Terminate the line with \r\n
+    /// @return	true if the end fits, false otherwise
+    ///
+    bool end();
+
+    ///
+    /// @brief	Line
+    /// @return	line as const char*, \0-terminated
+    ///
+    const char * c_str();
+
+    ///
+    /// @brief	Length
+    /// @return	number of characters, excluding the final \0
+    ///
+    size_t length();
+
+    ///
+    /// @brief	Overflow
+    /// @return	true if at least one add() did not fit since clear()
+    ///
+    bool overflow();
+
+  private:
+    char * _buffer;
+    size_t _size;
+    size_t _length;
+    char _separator;
+    uint8_t _options;
+    bool _overflow;
+};
+
 #endif
@@ -0,0 +1,91 @@
+//
+// Sensor_Variometer.cpp
+// Library C++ code
+// ----------------------------------
+// Developed with embedXcode+
+// https://embedXcode.weebly.com
+//
+// Project 		SensorsBoosterPack
+//
+// Created by 	Rei Vilo, 19 Oct 2026
+// 				https://embeddedcomputing.weebly.com
+//
+// Copyright	(c) Rei Vilo, 2015-2026
+// Licence		CC = BY SA NC
+//
+// See 			Sensor_Variometer.h and ReadMe.txt for references
+//
+
+
+// Include library header
+#include "Sensor_Variometer.h"
+
+// Code
+Barometric_Variometer::Barometric_Variometer(float alpha, float beta)
+{
+    setGains(alpha, beta);
+    reset();
+}
+
+void Barometric_Variometer::setGains(float alpha, float beta)
+{
+    _alpha = alpha;
+    _beta = beta;
+}
+
+void Barometric_Variometer::setSeaLevel(float seaLevelPressure)
+{
+    _barometric.setSeaLevel(seaLevelPressure);
+    reset();
+}
+
+void Barometric_Variometer::reset()
+{
+    _altitude = 0.0;
+    _verticalSpeed = 0.0;
+    _timeMicros = 0;
+    _started = false;
+}
+
+void Barometric_Variometer::update(float pressure, uint32_t timeMicros)
+{
+    updateAltitude(_barometric.altitude(pressure), timeMicros);
+}
+
+void Barometric_Variometer::updateAltitude(float altitudeMeters, uint32_t timeMicros)
+{
+    if (not _started)
+    {
+        _altitude = altitudeMeters;
+        _verticalSpeed = 0.0;
+        _timeMicros = timeMicros;
+        _started = true;
+        return;
+    }
+
+    // Unsigned difference survives the micros() roll-over
+    uint32_t elapsed = timeMicros - _timeMicros;
+    if (elapsed == 0)
+    {
+        return;
+    }
+    _timeMicros = timeMicros;
+    float period = (float)elapsed * 1e-6f;
+
+    // Predict, then correct with the residual
+    float predicted = _altitude + _verticalSpeed * period;
+    float residual = altitudeMeters - predicted;
+
+    _altitude = predicted + _alpha * residual;
+    _verticalSpeed += _beta * residual / period;
+}
+
+float Barometric_Variometer::altitude()
+{
+    return _altitude;
+}
+
+float Barometric_Variometer::verticalSpeed()
+{
+    return _verticalSpeed;
+}
@@ -0,0 +1,145 @@
+///
+/// @file		Sensor_Variometer.h
+/// @brief		Library header
+/// @details	Vertical speed estimation from barometric pressure
+/// @n
+/// @n @b		Project SensorsBoosterPack
+/// @n @a		Developed with [embedXcode+](https://embedXcode.weebly.com)
+///
+/// @author		Rei Vilo
+/// @author		https://embeddedcomputing.weebly.com
+///
+/// @date		19 Oct 2026
+/// @version	101
+///
+/// @copyright	(c) Rei Vilo, 2015-2026
+/// @copyright	CC = BY SA NC
+///
+/// @see		ReadMe.txt for references
+///
+
+#ifndef Sensor_Variometer_RELEASE
+///
+/// @brief	Release
+///
+#define Sensor_Variometer_RELEASE 101
+
+
+// Include core library - IDE-based
+#if defined(WIRING) // Wiring specific
+#include "Wiring.h"
+#elif defined(MAPLE_IDE) // Maple specific
+#include "WProgram.h"
+#elif defined(ROBOTIS) // Robotis specific
+#include "libpandora_types.h"
+#include "pandora.h"
+#elif defined(MPIDE) // chipKIT specific
+#include "WProgram.h"
+#elif defined(DIGISPARK) // Digispark specific
+#include "Arduino.h"
+#elif defined(ENERGIA) // LaunchPad specific
+#include "Energia.h"
+#elif defined(LITTLEROBOTFRIENDS) // LittleRobotFriends specific
+#include "LRF.h"
+#elif defined(MICRODUINO) // Microduino specific
+#include "Arduino.h"
+#elif defined(TEENSYDUINO) // Teensy specific
+#include "Arduino.h"
+#elif defined(REDBEARLAB) // RedBearLab specific
+#include "Arduino.h"
+#elif defined(RFDUINO) // RFduino specific
+#include "Arduino.h"
+#elif defined(SPARK) // Spark specific
+#include "application.h"
+#elif defined(ARDUINO) // Arduino 1.0 and 1.5 specific
+#include "Arduino.h"
+#else // error
+#   error Platform not defined
+#endif // end IDE
+
+#include "Sensor_Barometric.h"
+
+///
+/// @brief      Default filter gains
+/// @details    Suitable for BMP280 and BME280 in normal mode at 10 to 100 Hz
+/// @{
+#define VARIOMETER_ALPHA 0.10 ///< altitude gain, 0..1
+#define VARIOMETER_BETA  0.005 ///< vertical speed gain, 0..alpha^2 / (2 - alpha)
+/// @}
+
+///
+/// @brief      Variometer
+/// @details    Alpha-beta filter on the altitude derived from the pressure samples.
+/// @n          Each update() is O(1), with no allocation and no pow().
+/// @code
+///    myBMP280.get();
+///    myVariometer.update(myBMP280.pressure(), micros());
+///    Serial.print(myVariometer.verticalSpeed());
+/// @endcode
+///
+class Barometric_Variometer
+{
+  public:
+    ///
+    /// @brief	Constructor
+    /// @param  alpha altitude gain, default=VARIOMETER_ALPHA
+    /// @param  beta vertical speed gain, default=VARIOMETER_BETA
+    ///
+    Barometric_Variometer(float alpha = VARIOMETER_ALPHA, float beta = VARIOMETER_BETA);
+
+    ///
+    /// @brief	Set filter gains
+    /// @param  alpha altitude gain, 0..1
+    /// @param  beta vertical speed gain
+    /// @note   Lower gains mean smoother but slower estimates.
+    ///
+    void setGains(float alpha, float beta);
+
+    ///
+    /// @brief	Set sea level pressure
+    /// @param  seaLevelPressure pressure at sea level, in hPa
+    ///
+    void setSeaLevel(float seaLevelPressure);
+
+    ///
+    /// @brief	Restart the estimation with the next sample
+    ///
+    void reset();
+
+    ///
+    /// @brief	Update with a pressure sample
+    /// @param  pressure pressure, in hPa
+    /// @param  timeMicros time-stamp of the sample, in us, from micros()
+    ///
+    void update(float pressure, uint32_t timeMicros);
+
+    ///
+    /// @brief	Update with an altitude sample
+    /// @param  altitudeMeters altitude, in meter
+    /// @param  timeMicros time-stamp of the sample, in us, from micros()
+    ///
+    void updateAltitude(float altitudeMeters, uint32_t timeMicros);
+
+    ///
+    /// @brief	Filtered altitude
+    /// @return altitude, in meter
+    ///
+    float altitude();
+
+    ///
+    /// @brief	Filtered vertical speed
+    /// @return vertical speed, in meter per second, positive when climbing
+    ///
+    float verticalSpeed();
+
+  private:
+    Barometric_Formula _barometric;
+    float _alpha;
+    float _beta;
+    float _altitude;
+    float _verticalSpeed;
+    uint32_t _timeMicros;
+    bool _started;
+};
+
+#endif
@@ -86,6 +86,38 @@ uint16_t readRegister16(uint8_t device, uint8_t command, uint8_t mode)
     return value;
 }
 
+void readRegisters(uint8_t device, uint8_t command, uint8_t * buffer, uint8_t length)
+{
+    Wire.beginTransmission(device);
+    Wire.write(command);
+    Wire.endTransmission();
+
+    Wire.requestFrom(device, length);
+    while (Wire.available() < length);
+
+    for (uint8_t index = 0; index < length; index++)
+    {
+        buffer[index] = Wire.read();
+    }
+}
+
+void readRegisters16(uint8_t device, const uint8_t * commands, uint16_t * values, uint8_t count)
+{
+    for (uint8_t index = 0; index < count; index++)
+    {
+        Wire.beginTransmission(device);
+        Wire.write(commands[index]);
+        Wire.endTransmission(false);
+
+        // Stop after the last register only
+        Wire.requestFrom(device, (uint8_t)2, (uint8_t)(index + 1 == count));
+        while (Wire.available() < 2);
+
+        values[index]  = Wire.read() << 8;
+        values[index] |= Wire.read();
+    }
+}
+
 void delayBusy(uint32_t ms)
 {
     uint32_t chrono = millis() + ms;
@@ -96,6 +96,26 @@ uint8_t readRegister8(uint8_t device, uint8_t command);
 ///
 uint16_t readRegister16(uint8_t device, uint8_t command, uint8_t mode = MSBFIRST);
 
+///
+/// @brief	Read consecutive bytes in a single transaction
+/// @param	device I2C address, 7-bit coded
+/// @param	command first register, 8-bit
+/// @param	buffer array for the values, at least length bytes
+/// @param	length number of bytes to read
+/// @note   The device should auto-increment the register address.
+///
+void readRegisters(uint8_t device, uint8_t command, uint8_t * buffer, uint8_t length);
+
+///
+/// @brief	Read scattered 2-byte registers with repeated starts
+/// @param	device I2C address, 7-bit coded
+/// @param	commands array of registers, 8-bit
+/// @param	values array for the values, MSBFIRST, at least count values
+/// @param	count number of registers
+/// @note   For devices without register auto-increment: a single stop ends the sequence.
+///
+void readRegisters16(uint8_t device, const uint8_t * commands, uint16_t * values, uint8_t count);
+
 ///
 /// @brief    Delay without yield
 /// @param    ms period to wait for, ms